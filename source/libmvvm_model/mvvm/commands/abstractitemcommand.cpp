@@ -11,6 +11,7 @@
 #include "mvvm/model/modelutils.h"
 #include "mvvm/model/path.h"
 #include "mvvm/model/sessionitem.h"
+#include "mvvm/model/sessionmodel.h"
 #include <stdexcept>
 
 using namespace ModelView;
@@ -88,6 +89,28 @@ CommandResult AbstractItemCommand::result() const
     return p_impl->m_result;
 }
 
+//! Returns command identifier used for command merging, -1 means that command can't be merged.
+
+int AbstractItemCommand::id() const
+{
+    return -1;
+}
+
+//! Attempts to merge the command, executed right after this one, into this command. Returns true
+//! on success, in this case undo of this command should undo both of them.
+
+bool AbstractItemCommand::mergeWith(const AbstractItemCommand*)
+{
+    return false;
+}
+
+//! Returns estimated number of bytes held by the command.
+
+size_t AbstractItemCommand::memoryFootprint() const
+{
+    return sizeof(AbstractItemCommand) + sizeof(AbstractItemCommandImpl) + p_impl->m_text.size();
+}
+
 //! Sets command obsolete flag.
 
 void AbstractItemCommand::setObsolete(bool flag)
@@ -112,6 +135,14 @@ SessionItem* AbstractItemCommand::itemFromPath(const Path& path) const
     return Utils::ItemFromPath(*p_impl->m_model, path);
 }
 
+//! Returns item with given identifier, found through the item pool of the model. Unlike a Path,
+//! the identifier stays valid when items are inserted or removed elsewhere in the tree.
+
+SessionItem* AbstractItemCommand::itemFromIdentifier(const identifier_type& identifier) const
+{
+    return p_impl->m_model->findItem(identifier);
+}
+
 SessionModel* AbstractItemCommand::model() const
 {
     return p_impl->m_model;
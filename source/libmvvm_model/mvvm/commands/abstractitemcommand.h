@@ -11,6 +11,7 @@
 #define MVVM_COMMANDS_ABSTRACTITEMCOMMAND_H
 
 #include "mvvm/commands/commandresult.h"
+#include "mvvm/core/types.h"
 #include "mvvm/model_export.h"
 #include <memory>
 #include <string>
@@ -41,11 +42,18 @@ public:
 
     CommandResult result() const;
 
+    virtual int id() const;
+
+    virtual bool mergeWith(const AbstractItemCommand* other);
+
+    virtual size_t memoryFootprint() const;
+
 protected:
     void setObsolete(bool flag);
     void setDescription(const std::string& text);
     Path pathFromItem(SessionItem* item) const;
     SessionItem* itemFromPath(const Path& path) const;
+    SessionItem* itemFromIdentifier(const identifier_type& identifier) const;
     SessionModel* model() const;
     void setResult(const CommandResult& command_result);
 
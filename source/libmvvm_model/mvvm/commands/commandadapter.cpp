@@ -12,21 +12,85 @@
 
 using namespace ModelView;
 
-CommandAdapter::CommandAdapter(std::shared_ptr<AbstractItemCommand> command)
-    : m_command(std::move(command))
+//! Constructs adapter for given command. If `memory_total` is given, adapter keeps its own
+//! footprint added to it, while the adapter exists.
+
+CommandAdapter::CommandAdapter(std::shared_ptr<AbstractItemCommand> command, bool mergeable,
+                               size_t* memory_total)
+    : m_command(std::move(command)), m_mergeable(mergeable), m_memory_total(memory_total)
+{
+}
+
+CommandAdapter::~CommandAdapter()
 {
+    set_footprint(0);
 }
 
-CommandAdapter::~CommandAdapter() = default;
+//! Undo the command. Released command doesn't do anything: it is the oldest in the stack, so the
+//! model stays in the state after this command until the command is redone.
 
 void CommandAdapter::undo()
 {
+    if (!m_command)
+        return;
     m_command->undo();
+    set_footprint(m_command->memoryFootprint());
 }
 
 void CommandAdapter::redo()
 {
+    if (!m_command)
+        return;
     m_command->execute();
+    set_footprint(m_command->memoryFootprint());
     setObsolete(m_command->isObsolete());
     setText(QString::fromStdString(m_command->description()));
 }
+
+int CommandAdapter::id() const
+{
+    return m_command ? m_command->id() : -1;
+}
+
+//! Merges the command, which was just pushed into QUndoStack, into this command.
+
+bool CommandAdapter::mergeWith(const QUndoCommand* other)
+{
+    auto adapter = dynamic_cast<const CommandAdapter*>(other);
+    if (!m_command || !adapter || !adapter->m_mergeable
+        || !m_command->mergeWith(adapter->m_command.get()))
+        return false;
+
+    set_footprint(m_command->memoryFootprint());
+    setText(QString::fromStdString(m_command->description()));
+    return true;
+}
+
+//! Returns estimated number of bytes held by the command.
+
+size_t CommandAdapter::memoryFootprint() const
+{
+    return m_footprint;
+}
+
+//! Releases underlying command together with all data it holds. Returns number of freed bytes.
+
+size_t CommandAdapter::release()
+{
+    auto result = m_footprint;
+    m_command.reset();
+    set_footprint(0);
+    return result;
+}
+
+bool CommandAdapter::isReleased() const
+{
+    return !m_command;
+}
+
+void CommandAdapter::set_footprint(size_t value)
+{
+    if (m_memory_total)
+        *m_memory_total = *m_memory_total - m_footprint + value;
+    m_footprint = value;
+}
@@ -22,14 +22,28 @@ class AbstractItemCommand;
 
 class MVVM_MODEL_EXPORT CommandAdapter : public QUndoCommand {
 public:
-    CommandAdapter(std::shared_ptr<AbstractItemCommand> command);
+    CommandAdapter(std::shared_ptr<AbstractItemCommand> command, bool mergeable = false,
+                   size_t* memory_total = nullptr);
     ~CommandAdapter() override;
 
     void undo() override;
     void redo() override;
 
+    int id() const override;
+    bool mergeWith(const QUndoCommand* other) override;
+
+    size_t memoryFootprint() const;
+
+    size_t release();
+    bool isReleased() const;
+
 private:
+    void set_footprint(size_t value);
+
     std::shared_ptr<AbstractItemCommand> m_command;
+    bool m_mergeable{false};         //! command is allowed to be merged into the previous one
+    size_t m_footprint{0};           //! memory footprint of the command after last undo/redo
+    size_t* m_memory_total{nullptr}; //! running total of footprints of all commands in the stack
 };
 
 } // namespace ModelView
@@ -10,8 +10,10 @@
 #include "mvvm/commands/commandservice.h"
 #include "mvvm/commands/copyitemcommand.h"
 #include "mvvm/commands/insertnewitemcommand.h"
+#include "mvvm/commands/insertnewitemscommand.h"
 #include "mvvm/commands/moveitemcommand.h"
 #include "mvvm/commands/removeitemcommand.h"
+#include "mvvm/commands/removeitemscommand.h"
 #include "mvvm/commands/setvaluecommand.h"
 #include "mvvm/commands/undostack.h"
 #include "mvvm/model/sessionitem.h"
@@ -42,6 +44,34 @@ SessionItem* CommandService::insertNewItem(const item_factory_func_t& func, Sess
         process_command<InsertNewItemCommand>(func, parent, TagRow{tagrow.tag, actual_row}));
 }
 
+//! Inserts given number of new items into consecutive rows of parent's tag, starting from given
+//! row. Done as a single command, listeners are notified about the whole range at once.
+
+std::vector<SessionItem*> CommandService::insertNewItems(const item_factory_func_t& func,
+                                                         SessionItem* parent, const TagRow& tagrow,
+                                                         int count)
+{
+    if (!parent)
+        parent = m_model->rootItem();
+
+    if (count <= 0)
+        return {};
+
+    int actual_row = tagrow.row < 0 ? parent->itemCount(tagrow.tag) : tagrow.row;
+
+    auto first = std::get<SessionItem*>(process_command<InsertNewItemsCommand>(
+        func, parent, TagRow{tagrow.tag, actual_row}, count));
+    if (!first)
+        return {};
+
+    auto tag = first->tagRow().tag;
+    std::vector<SessionItem*> result;
+    result.reserve(static_cast<size_t>(count));
+    for (int index = 0; index < count; ++index)
+        result.push_back(parent->getItem(tag, actual_row + index));
+    return result;
+}
+
 SessionItem* CommandService::copyItem(const SessionItem* item, SessionItem* parent,
                                       const TagRow& tagrow)
 {
@@ -75,6 +105,21 @@ void CommandService::removeItem(SessionItem* parent, const TagRow& tagrow)
     process_command<RemoveItemCommand>(parent, tagrow);
 }
 
+//! Removes given number of items occupying consecutive rows of parent's tag, starting from given
+//! row. Done as a single command, listeners are notified about the whole range at once.
+
+bool CommandService::removeItems(SessionItem* parent, const TagRow& tagrow, int count)
+{
+    if (parent->model() != m_model)
+        throw std::runtime_error(
+            "CommandService::removeItems() -> Item doesn't belong to given model");
+
+    if (count <= 0)
+        return false;
+
+    return std::get<bool>(process_command<RemoveItemsCommand>(parent, tagrow, count));
+}
+
 void CommandService::moveItem(SessionItem* item, SessionItem* new_parent, const TagRow& tagrow)
 {
     if (item->model() != m_model)
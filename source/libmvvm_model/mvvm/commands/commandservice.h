@@ -16,6 +16,7 @@
 #include "mvvm/model/function_types.h"
 #include "mvvm/model_export.h"
 #include <memory>
+#include <vector>
 
 namespace ModelView {
 
@@ -34,12 +35,17 @@ public:
     SessionItem* insertNewItem(const item_factory_func_t& func, SessionItem* parent,
                                const TagRow& tagrow);
 
+    std::vector<SessionItem*> insertNewItems(const item_factory_func_t& func, SessionItem* parent,
+                                             const TagRow& tagrow, int count);
+
     SessionItem* copyItem(const SessionItem* item, SessionItem* parent, const TagRow& tagrow);
 
     bool setData(SessionItem* item, const Variant& value, int role);
 
     void removeItem(SessionItem* parent, const TagRow& tagrow);
 
+    bool removeItems(SessionItem* parent, const TagRow& tagrow, int count);
+
     void moveItem(SessionItem* item, SessionItem* new_parent, const TagRow& tagrow);
 
     UndoStackInterface* undoStack() const;
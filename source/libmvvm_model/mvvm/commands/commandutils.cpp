@@ -8,6 +8,7 @@
 // ************************************************************************** //
 
 #include "mvvm/commands/commandutils.h"
+#include "mvvm/commands/detacheditembackupstrategy.h"
 #include "mvvm/model/sessionmodel.h"
 #include "mvvm/serialization/jsonitembackupstrategy.h"
 #include "mvvm/serialization/jsonitemcopystrategy.h"
@@ -19,9 +20,36 @@ ModelView::CreateItemBackupStrategy(const ModelView::SessionModel* model)
     return std::make_unique<JsonItemBackupStrategy>(model->factory());
 }
 
+std::unique_ptr<ModelView::ItemKeepStrategy> ModelView::CreateDetachedItemBackupStrategy()
+{
+    return std::make_unique<DetachedItemBackupStrategy>();
+}
+
 std::unique_ptr<ModelView::ItemCopyStrategy>
 ModelView::CreateItemCopyStrategy(const ModelView::SessionModel* model)
 {
     assert(model);
     return std::make_unique<JsonItemCopyStrategy>(model->factory());
 }
+
+ModelView::BatchGuard::BatchGuard(ModelView::SessionModel* model) : m_model(model)
+{
+    if (m_model)
+        m_model->beginBatch();
+}
+
+ModelView::BatchGuard::~BatchGuard()
+{
+    if (m_model)
+        m_model->abortBatch();
+}
+
+//! Ends the batch and delivers collected notifications.
+
+void ModelView::BatchGuard::commit()
+{
+    auto model = m_model;
+    m_model = nullptr; // batch is closed by endBatch() even if listeners throw
+    if (model)
+        model->endBatch();
+}
@@ -15,6 +15,7 @@
 
 #include "mvvm/interfaces/itembackupstrategy.h"
 #include "mvvm/interfaces/itemcopystrategy.h"
+#include "mvvm/interfaces/itemkeepstrategy.h"
 #include <memory>
 
 namespace ModelView {
@@ -27,12 +28,34 @@ class SessionModel;
 MVVM_MODEL_EXPORT std::unique_ptr<ItemBackupStrategy>
 CreateItemBackupStrategy(const SessionModel* model);
 
+//! Creates strategy to keep items removed from the model for later restore. Restored items are
+//! the very same objects, no serialization is involved.
+
+MVVM_MODEL_EXPORT std::unique_ptr<ItemKeepStrategy> CreateDetachedItemBackupStrategy();
+
 //! Returns strategy for item copying. Identifiers of the copy will be different from identifiers
 //! of the original.
 
 MVVM_MODEL_EXPORT std::unique_ptr<ItemCopyStrategy>
 CreateItemCopyStrategy(const SessionModel* model);
 
+//! Collects notifications of the model in the batch during the lifetime of the guard. Collected
+//! notifications are delivered by commit(). The guard destroyed without commit (i.e. on exception)
+//! closes the batch without delivering them, so listeners never run from the destructor.
+
+class MVVM_MODEL_EXPORT BatchGuard {
+public:
+    explicit BatchGuard(SessionModel* model);
+    ~BatchGuard();
+    BatchGuard(const BatchGuard&) = delete;
+    BatchGuard& operator=(const BatchGuard&) = delete;
+
+    void commit();
+
+private:
+    SessionModel* m_model{nullptr};
+};
+
 } // namespace ModelView
 
 #endif // MVVM_COMMANDS_COMMANDUTILS_H
@@ -9,9 +9,8 @@
 
 #include "mvvm/commands/copyitemcommand.h"
 #include "mvvm/commands/commandutils.h"
-#include "mvvm/interfaces/itembackupstrategy.h"
+#include "mvvm/interfaces/itemkeepstrategy.h"
 #include "mvvm/interfaces/itemcopystrategy.h"
-#include "mvvm/model/path.h"
 #include "mvvm/model/sessionitem.h"
 #include <sstream>
 
@@ -23,8 +22,8 @@ std::string generate_description(const std::string& modelType, const TagRow& tag
 
 struct CopyItemCommand::CopyItemCommandImpl {
     TagRow tagrow;
-    std::unique_ptr<ItemBackupStrategy> backup_strategy;
-    Path item_path;
+    std::unique_ptr<ItemKeepStrategy> backup_strategy;
+    identifier_type parent_identifier;
     CopyItemCommandImpl(TagRow tagrow) : tagrow(std::move(tagrow)) {}
 };
 
@@ -34,33 +33,40 @@ CopyItemCommand::CopyItemCommand(const SessionItem* item, SessionItem* parent, T
     setResult(nullptr);
 
     setDescription(generate_description(item->modelType(), p_impl->tagrow));
-    p_impl->backup_strategy = CreateItemBackupStrategy(parent->model());
-    p_impl->item_path = pathFromItem(parent);
+    p_impl->backup_strategy = CreateDetachedItemBackupStrategy();
+    p_impl->parent_identifier = parent->identifier();
 
     auto copy_strategy = CreateItemCopyStrategy(parent->model()); // to modify id's
-    auto item_copy = copy_strategy->createCopy(item);
-
-    p_impl->backup_strategy->saveItem(item_copy.get());
+    p_impl->backup_strategy->keepItem(copy_strategy->createCopy(item));
 }
 
 CopyItemCommand::~CopyItemCommand() = default;
 
+//! Returns estimated number of bytes held by the command, including item backup.
+
+size_t CopyItemCommand::memoryFootprint() const
+{
+    return AbstractItemCommand::memoryFootprint() + p_impl->backup_strategy->memoryFootprint();
+}
+
 void CopyItemCommand::undo_command()
 {
-    auto parent = itemFromPath(p_impl->item_path);
-    delete parent->takeItem(p_impl->tagrow);
+    auto parent = itemFromIdentifier(p_impl->parent_identifier);
+    if (auto item = parent->takeItem(p_impl->tagrow); item)
+        p_impl->backup_strategy->keepItem(std::unique_ptr<SessionItem>(item));
     setResult(nullptr);
 }
 
 void CopyItemCommand::execute_command()
 {
-    auto parent = itemFromPath(p_impl->item_path);
+    auto parent = itemFromIdentifier(p_impl->parent_identifier);
     auto item = p_impl->backup_strategy->restoreItem();
     if (parent->insertItem(item.get(), p_impl->tagrow)) {
         auto result = item.release();
         setResult(result);
     }
     else {
+        p_impl->backup_strategy->keepItem(std::move(item));
         setResult(nullptr);
         setObsolete(true);
     }
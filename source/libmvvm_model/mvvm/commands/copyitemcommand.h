@@ -24,6 +24,8 @@ public:
     CopyItemCommand(const SessionItem* item, SessionItem* parent, TagRow tagrow);
     ~CopyItemCommand() override;
 
+    size_t memoryFootprint() const override;
+
 private:
     void undo_command() override;
     void execute_command() override;
@@ -0,0 +1,112 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/commands/detacheditembackupstrategy.h"
+#include "mvvm/model/customvariants.h"
+#include "mvvm/model/sessionitem.h"
+#include "mvvm/model/sessionitemcontainer.h"
+#include "mvvm/model/sessionitemdata.h"
+#include "mvvm/model/sessionitemtags.h"
+#include <stdexcept>
+
+using namespace ModelView;
+
+namespace {
+
+//! Returns estimated number of bytes occupied by the item itself, its data roles and tag storage.
+size_t node_footprint(const SessionItem* item)
+{
+    size_t result = sizeof(SessionItem) + sizeof(SessionItemData) + sizeof(SessionItemTags);
+    for (const auto& x : *item->itemData())
+        result += sizeof(x.m_role) + Utils::VariantFootprint(x.m_data);
+    result += static_cast<size_t>(item->itemTags()->tagsCount()) * sizeof(SessionItemContainer);
+    return result;
+}
+
+//! Returns estimated number of bytes occupied by the item together with its descendants.
+size_t item_footprint(const SessionItem* item)
+{
+    size_t result{0};
+    std::vector<const SessionItem*> stack = {item};
+    while (!stack.empty()) {
+        auto current = stack.back();
+        stack.pop_back();
+        result += node_footprint(current);
+        for (auto child : current->childrenRange()) {
+            result += sizeof(SessionItem*); // slot in the parent's container
+            stack.push_back(child);
+        }
+    }
+    return result;
+}
+
+} // namespace
+
+struct DetachedItemBackupStrategy::DetachedItemBackupStrategyImpl {
+    //! Kept items are handed back on restore, and kept again on the next removal.
+    std::vector<std::unique_ptr<SessionItem>> m_items;
+    size_t m_footprint{0};
+
+    void keep(std::vector<std::unique_ptr<SessionItem>> items)
+    {
+        m_footprint = 0;
+        for (const auto& item : items)
+            m_footprint += item_footprint(item.get());
+        m_items = std::move(items);
+    }
+
+    //! Hands kept items back to the caller.
+    std::vector<std::unique_ptr<SessionItem>> take()
+    {
+        auto result = std::move(m_items);
+        m_items.clear();
+        m_footprint = 0;
+        return result;
+    }
+};
+
+DetachedItemBackupStrategy::DetachedItemBackupStrategy()
+    : p_impl(std::make_unique<DetachedItemBackupStrategyImpl>())
+{
+}
+
+DetachedItemBackupStrategy::~DetachedItemBackupStrategy() = default;
+
+std::unique_ptr<SessionItem> DetachedItemBackupStrategy::restoreItem()
+{
+    if (p_impl->m_items.size() != 1)
+        throw std::runtime_error("Error in DetachedItemBackupStrategy: no item to restore.");
+
+    return std::move(p_impl->take().front());
+}
+
+std::vector<std::unique_ptr<SessionItem>> DetachedItemBackupStrategy::restoreItems()
+{
+    return p_impl->take();
+}
+
+void DetachedItemBackupStrategy::keepItem(std::unique_ptr<SessionItem> item)
+{
+    item->releaseMapper();
+    std::vector<std::unique_ptr<SessionItem>> items;
+    items.push_back(std::move(item));
+    p_impl->keep(std::move(items));
+}
+
+void DetachedItemBackupStrategy::keepItems(std::vector<std::unique_ptr<SessionItem>> items)
+{
+    for (const auto& item : items)
+        item->releaseMapper();
+    p_impl->keep(std::move(items));
+}
+
+size_t DetachedItemBackupStrategy::memoryFootprint() const
+{
+    return p_impl->m_footprint;
+}
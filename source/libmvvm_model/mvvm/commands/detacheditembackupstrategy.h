@@ -0,0 +1,47 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_COMMANDS_DETACHEDITEMBACKUPSTRATEGY_H
+#define MVVM_COMMANDS_DETACHEDITEMBACKUPSTRATEGY_H
+
+#include "mvvm/interfaces/itemkeepstrategy.h"
+#include <memory>
+
+namespace ModelView {
+
+class SessionItem;
+
+//! Provides backup of items removed from the model by keeping the detached items themselves.
+//! Restore hands back the very same objects, so identifiers are preserved and no serialization
+//! takes place. Kept items are not registered in the model's pool and their item mappers are
+//! released.
+
+class MVVM_MODEL_EXPORT DetachedItemBackupStrategy : public ItemKeepStrategy {
+public:
+    DetachedItemBackupStrategy();
+    ~DetachedItemBackupStrategy() override;
+
+    std::unique_ptr<SessionItem> restoreItem() override;
+
+    std::vector<std::unique_ptr<SessionItem>> restoreItems() override;
+
+    void keepItem(std::unique_ptr<SessionItem> item) override;
+
+    void keepItems(std::vector<std::unique_ptr<SessionItem>> items) override;
+
+    size_t memoryFootprint() const override;
+
+private:
+    struct DetachedItemBackupStrategyImpl;
+    std::unique_ptr<DetachedItemBackupStrategyImpl> p_impl;
+};
+
+} // namespace ModelView
+
+#endif // MVVM_COMMANDS_DETACHEDITEMBACKUPSTRATEGY_H
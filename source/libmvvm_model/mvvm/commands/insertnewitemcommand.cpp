@@ -8,7 +8,6 @@
 // ************************************************************************** //
 
 #include "mvvm/commands/insertnewitemcommand.h"
-#include "mvvm/model/path.h"
 #include "mvvm/model/sessionitem.h"
 #include <sstream>
 
@@ -21,7 +20,7 @@ std::string generate_description(const std::string& modelType, const TagRow& tag
 struct InsertNewItemCommand::InsertNewItemCommandImpl {
     item_factory_func_t factory_func;
     TagRow tagrow;
-    Path item_path;
+    identifier_type parent_identifier;
     std::string initial_identifier;
     InsertNewItemCommandImpl(item_factory_func_t func, TagRow tagrow)
         : factory_func(std::move(func)), tagrow(std::move(tagrow))
@@ -34,14 +33,14 @@ InsertNewItemCommand::InsertNewItemCommand(item_factory_func_t func, SessionItem
     : AbstractItemCommand(parent), p_impl(std::make_unique<InsertNewItemCommandImpl>(func, tagrow))
 {
     setResult(nullptr);
-    p_impl->item_path = pathFromItem(parent);
+    p_impl->parent_identifier = parent->identifier();
 }
 
 InsertNewItemCommand::~InsertNewItemCommand() = default;
 
 void InsertNewItemCommand::undo_command()
 {
-    auto parent = itemFromPath(p_impl->item_path);
+    auto parent = itemFromIdentifier(p_impl->parent_identifier);
     auto item = parent->takeItem(p_impl->tagrow);
     // saving identifier for later redo
     if (p_impl->initial_identifier.empty())
@@ -52,7 +51,7 @@ void InsertNewItemCommand::undo_command()
 
 void InsertNewItemCommand::execute_command()
 {
-    auto parent = itemFromPath(p_impl->item_path);
+    auto parent = itemFromIdentifier(p_impl->parent_identifier);
     auto child = p_impl->factory_func().release();
     // here we restore original identifier to get exactly same item on consequitive undo/redo
     if (!p_impl->initial_identifier.empty())
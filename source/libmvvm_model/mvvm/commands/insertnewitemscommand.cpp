@@ -0,0 +1,135 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/commands/insertnewitemscommand.h"
+#include "mvvm/commands/commandutils.h"
+#include "mvvm/model/sessionitem.h"
+#include "mvvm/model/sessionitemcontainer.h"
+#include "mvvm/model/sessionitemtags.h"
+#include <sstream>
+#include <stdexcept>
+
+using namespace ModelView;
+
+namespace {
+std::string generate_description(const std::string& modelType, const TagRow& tagrow, int count);
+
+//! Returns true if all items can be inserted into given parent starting from given position.
+bool can_insert_items(const SessionItem* parent, const TagRow& tagrow,
+                      const std::vector<std::unique_ptr<SessionItem>>& items);
+} // namespace
+
+struct InsertNewItemsCommand::InsertNewItemsCommandImpl {
+    item_factory_func_t factory_func;
+    TagRow tagrow;
+    int count{0};
+    identifier_type parent_identifier;
+    std::vector<std::string> initial_identifiers;
+    InsertNewItemsCommandImpl(item_factory_func_t func, TagRow tagrow, int count)
+        : factory_func(std::move(func)), tagrow(std::move(tagrow)), count(count)
+    {
+    }
+};
+
+InsertNewItemsCommand::InsertNewItemsCommand(item_factory_func_t func, SessionItem* parent,
+                                             const TagRow& tagrow, int count)
+    : AbstractItemCommand(parent)
+    , p_impl(std::make_unique<InsertNewItemsCommandImpl>(func, tagrow, count))
+{
+    setResult(nullptr);
+    p_impl->parent_identifier = parent->identifier();
+}
+
+InsertNewItemsCommand::~InsertNewItemsCommand() = default;
+
+void InsertNewItemsCommand::undo_command()
+{
+    auto parent = itemFromIdentifier(p_impl->parent_identifier);
+    // saving identifiers for later redo
+    bool save_identifiers = p_impl->initial_identifiers.empty();
+
+    // whole range is taken at once with single notification, or nothing is taken
+    auto items = parent->takeItems(p_impl->tagrow, p_impl->count);
+    if (items.empty())
+        throw std::runtime_error("InsertNewItemsCommand::undo_command() -> Can't take items.");
+
+    for (auto item : items) {
+        if (save_identifiers)
+            p_impl->initial_identifiers.push_back(item->identifier());
+        delete item;
+    }
+    setResult(nullptr);
+}
+
+void InsertNewItemsCommand::execute_command()
+{
+    auto parent = itemFromIdentifier(p_impl->parent_identifier);
+
+    std::vector<std::unique_ptr<SessionItem>> items;
+    items.reserve(static_cast<size_t>(p_impl->count));
+    for (int index = 0; index < p_impl->count; ++index) {
+        items.push_back(p_impl->factory_func());
+        // here we restore original identifier to get exactly same item on consequitive undo/redo
+        if (!p_impl->initial_identifiers.empty())
+            items.back()->setData(QVariant::fromValue(p_impl->initial_identifiers[index]),
+                                  ItemDataRole::IDENTIFIER, /*direct*/ true);
+    }
+
+    auto model_type = items.empty() ? std::string() : items.front()->modelType();
+    setDescription(generate_description(model_type, p_impl->tagrow, p_impl->count));
+
+    if (items.empty() || !can_insert_items(parent, p_impl->tagrow, items)) {
+        setObsolete(true);
+        return;
+    }
+
+    BatchGuard batch(model());
+    setResult(items.front().get());
+    for (int index = 0; index < p_impl->count; ++index) {
+        auto child = items[index].release();
+        if (!parent->insertItem(child, {p_impl->tagrow.tag, p_impl->tagrow.row + index})) {
+            delete child;
+            throw std::runtime_error("InsertNewItemsCommand::execute_command() -> Can't insert");
+        }
+    }
+    batch.commit();
+}
+
+namespace {
+std::string generate_description(const std::string& modelType, const TagRow& tagrow, int count)
+{
+    std::ostringstream ostr;
+    ostr << "New items type '" << modelType << "' count:" << count << " tag:'" << tagrow.tag
+         << "', row:" << tagrow.row;
+    return ostr.str();
+}
+
+bool can_insert_items(const SessionItem* parent, const TagRow& tagrow,
+                      const std::vector<std::unique_ptr<SessionItem>>& items)
+{
+    auto tags = parent->itemTags();
+    const auto& tag = tagrow.tag.empty() ? tags->defaultTag() : tagrow.tag;
+    for (auto container : *tags) {
+        if (container->name() != tag)
+            continue;
+
+        const auto& tag_info = container->tagInfo();
+        const int count = static_cast<int>(items.size());
+        if (tagrow.row < 0 || tagrow.row > container->itemCount())
+            return false;
+        if (tag_info.max() >= 0 && container->itemCount() + count > tag_info.max())
+            return false;
+        for (const auto& item : items)
+            if (!tag_info.isValidChild(item->modelTypeSymbol()))
+                return false;
+        return true;
+    }
+    return false;
+}
+} // namespace
@@ -0,0 +1,40 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_COMMANDS_INSERTNEWITEMSCOMMAND_H
+#define MVVM_COMMANDS_INSERTNEWITEMSCOMMAND_H
+
+#include "mvvm/commands/abstractitemcommand.h"
+#include "mvvm/model/function_types.h"
+
+namespace ModelView {
+
+class SessionItem;
+class TagRow;
+
+//! Command for undo/redo to insert range of new items.
+//! Items are inserted in a single batch, so listeners get one notification about the whole range.
+
+class MVVM_MODEL_EXPORT InsertNewItemsCommand : public AbstractItemCommand {
+public:
+    InsertNewItemsCommand(item_factory_func_t func, SessionItem* parent, const TagRow& tagrow,
+                          int count);
+    ~InsertNewItemsCommand() override;
+
+private:
+    void undo_command() override;
+    void execute_command() override;
+
+    struct InsertNewItemsCommandImpl;
+    std::unique_ptr<InsertNewItemsCommandImpl> p_impl;
+};
+
+} // namespace ModelView
+
+#endif // MVVM_COMMANDS_INSERTNEWITEMSCOMMAND_H
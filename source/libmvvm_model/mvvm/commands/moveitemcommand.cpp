@@ -9,7 +9,6 @@
 
 #include "mvvm/commands/moveitemcommand.h"
 #include "mvvm/model/itemutils.h"
-#include "mvvm/model/path.h"
 #include "mvvm/model/sessionitem.h"
 #include <sstream>
 #include <stdexcept>
@@ -23,8 +22,8 @@ std::string generate_description(const TagRow& tagrow);
 
 struct MoveItemCommand::MoveItemCommandImpl {
     TagRow target_tagrow;
-    Path target_parent_path;
-    Path original_parent_path;
+    identifier_type target_parent_identifier;
+    identifier_type original_parent_identifier;
     TagRow original_tagrow;
     MoveItemCommandImpl(TagRow tagrow) : target_tagrow(std::move(tagrow))
     {
@@ -41,8 +40,8 @@ MoveItemCommand::MoveItemCommand(SessionItem* item, SessionItem* new_parent, Tag
     check_input_data(item, new_parent);
     setDescription(generate_description(p_impl->target_tagrow));
 
-    p_impl->target_parent_path = pathFromItem(new_parent);
-    p_impl->original_parent_path = pathFromItem(item->parent());
+    p_impl->target_parent_identifier = new_parent->identifier();
+    p_impl->original_parent_identifier = item->parent()->identifier();
     p_impl->original_tagrow = item->tagRow();
 
     if (Utils::IsSinglePropertyTag(*item->parent(), p_impl->original_tagrow.tag))
@@ -63,23 +62,19 @@ MoveItemCommand::~MoveItemCommand() = default;
 void MoveItemCommand::undo_command()
 {
     // first find items
-    auto current_parent = itemFromPath(p_impl->target_parent_path);
-    auto target_parent = itemFromPath(p_impl->original_parent_path);
+    auto current_parent = itemFromIdentifier(p_impl->target_parent_identifier);
+    auto target_parent = itemFromIdentifier(p_impl->original_parent_identifier);
 
     // then make manipulations
     auto taken = current_parent->takeItem(p_impl->target_tagrow);
     target_parent->insertItem(taken, p_impl->original_tagrow);
-
-    // adjusting new addresses
-    p_impl->target_parent_path = pathFromItem(current_parent);
-    p_impl->original_parent_path = pathFromItem(target_parent);
 }
 
 void MoveItemCommand::execute_command()
 {
     // first find items
-    auto original_parent = itemFromPath(p_impl->original_parent_path);
-    auto target_parent = itemFromPath(p_impl->target_parent_path);
+    auto original_parent = itemFromIdentifier(p_impl->original_parent_identifier);
+    auto target_parent = itemFromIdentifier(p_impl->target_parent_identifier);
 
     // then make manipulations
     auto taken = original_parent->takeItem(p_impl->original_tagrow);
@@ -90,10 +85,6 @@ void MoveItemCommand::execute_command()
     bool succeeded = target_parent->insertItem(taken, p_impl->target_tagrow);
     if (!succeeded)
         throw std::runtime_error("MoveItemCommand::execute() -> Can't insert item.");
-
-    // adjusting new addresses
-    p_impl->target_parent_path = pathFromItem(target_parent);
-    p_impl->original_parent_path = pathFromItem(original_parent);
 }
 
 namespace {
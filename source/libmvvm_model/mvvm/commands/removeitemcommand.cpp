@@ -9,8 +9,7 @@
 
 #include "mvvm/commands/removeitemcommand.h"
 #include "mvvm/commands/commandutils.h"
-#include "mvvm/interfaces/itembackupstrategy.h"
-#include "mvvm/model/path.h"
+#include "mvvm/interfaces/itemkeepstrategy.h"
 #include "mvvm/model/sessionitem.h"
 #include <sstream>
 
@@ -22,8 +21,8 @@ std::string generate_description(const TagRow& tagrow);
 
 struct RemoveItemCommand::RemoveItemCommandImpl {
     TagRow tagrow;
-    std::unique_ptr<ItemBackupStrategy> backup_strategy;
-    Path item_path;
+    std::unique_ptr<ItemKeepStrategy> backup_strategy;
+    identifier_type parent_identifier;
     RemoveItemCommandImpl(TagRow tagrow) : tagrow(std::move(tagrow)) {}
 };
 
@@ -34,25 +33,31 @@ RemoveItemCommand::RemoveItemCommand(SessionItem* parent, TagRow tagrow)
     setResult(false);
 
     setDescription(generate_description(p_impl->tagrow));
-    p_impl->backup_strategy = CreateItemBackupStrategy(parent->model());
-    p_impl->item_path = pathFromItem(parent);
+    p_impl->backup_strategy = CreateDetachedItemBackupStrategy();
+    p_impl->parent_identifier = parent->identifier();
 }
 
 RemoveItemCommand::~RemoveItemCommand() = default;
 
+//! Returns estimated number of bytes held by the command, including item backup.
+
+size_t RemoveItemCommand::memoryFootprint() const
+{
+    return AbstractItemCommand::memoryFootprint() + p_impl->backup_strategy->memoryFootprint();
+}
+
 void RemoveItemCommand::undo_command()
 {
-    auto parent = itemFromPath(p_impl->item_path);
+    auto parent = itemFromIdentifier(p_impl->parent_identifier);
     auto reco_item = p_impl->backup_strategy->restoreItem();
     parent->insertItem(reco_item.release(), p_impl->tagrow);
 }
 
 void RemoveItemCommand::execute_command()
 {
-    auto parent = itemFromPath(p_impl->item_path);
+    auto parent = itemFromIdentifier(p_impl->parent_identifier);
     if (auto child = parent->takeItem(p_impl->tagrow); child) {
-        p_impl->backup_strategy->saveItem(child);
-        delete child;
+        p_impl->backup_strategy->keepItem(std::unique_ptr<SessionItem>(child));
         setResult(true);
     }
     else {
@@ -24,6 +24,8 @@ public:
     RemoveItemCommand(SessionItem* parent, TagRow tagrow);
     ~RemoveItemCommand() override;
 
+    size_t memoryFootprint() const override;
+
 private:
     void undo_command() override;
     void execute_command() override;
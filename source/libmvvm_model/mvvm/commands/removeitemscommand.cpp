@@ -0,0 +1,94 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/commands/removeitemscommand.h"
+#include "mvvm/commands/commandutils.h"
+#include "mvvm/interfaces/itemkeepstrategy.h"
+#include "mvvm/model/sessionitem.h"
+#include <sstream>
+#include <stdexcept>
+
+using namespace ModelView;
+
+namespace {
+std::string generate_description(const TagRow& tagrow, int count);
+} // namespace
+
+struct RemoveItemsCommand::RemoveItemsCommandImpl {
+    TagRow tagrow;
+    int count{0};
+    std::unique_ptr<ItemKeepStrategy> backup_strategy;
+    identifier_type parent_identifier;
+    RemoveItemsCommandImpl(TagRow tagrow, int count) : tagrow(std::move(tagrow)), count(count) {}
+};
+
+RemoveItemsCommand::RemoveItemsCommand(SessionItem* parent, const TagRow& tagrow, int count)
+    : AbstractItemCommand(parent), p_impl(std::make_unique<RemoveItemsCommandImpl>(tagrow, count))
+{
+    setResult(false);
+
+    setDescription(generate_description(p_impl->tagrow, p_impl->count));
+    p_impl->backup_strategy = CreateDetachedItemBackupStrategy();
+    p_impl->parent_identifier = parent->identifier();
+}
+
+RemoveItemsCommand::~RemoveItemsCommand() = default;
+
+//! Returns estimated number of bytes held by the command, including item backup.
+
+size_t RemoveItemsCommand::memoryFootprint() const
+{
+    return AbstractItemCommand::memoryFootprint() + p_impl->backup_strategy->memoryFootprint();
+}
+
+void RemoveItemsCommand::undo_command()
+{
+    auto parent = itemFromIdentifier(p_impl->parent_identifier);
+    auto items = p_impl->backup_strategy->restoreItems();
+
+    std::vector<SessionItem*> children;
+    children.reserve(items.size());
+    for (const auto& item : items)
+        children.push_back(item.get());
+
+    if (!parent->insertItems(children, p_impl->tagrow)) {
+        p_impl->backup_strategy->keepItems(std::move(items));
+        throw std::runtime_error("RemoveItemsCommand::undo_command() -> Can't insert items.");
+    }
+
+    for (auto& item : items)
+        item.release(); // owned by the parent now
+}
+
+void RemoveItemsCommand::execute_command()
+{
+    auto parent = itemFromIdentifier(p_impl->parent_identifier);
+    auto children = parent->takeItems(p_impl->tagrow, p_impl->count);
+    if (children.empty()) {
+        setResult(false);
+        setObsolete(true);
+        return;
+    }
+
+    std::vector<std::unique_ptr<SessionItem>> items;
+    items.reserve(children.size());
+    for (auto child : children)
+        items.emplace_back(child);
+    p_impl->backup_strategy->keepItems(std::move(items));
+    setResult(true);
+}
+
+namespace {
+std::string generate_description(const TagRow& tagrow, int count)
+{
+    std::ostringstream ostr;
+    ostr << "Remove " << count << " items from tag '" << tagrow.tag << "', row " << tagrow.row;
+    return ostr.str();
+}
+} // namespace
@@ -0,0 +1,40 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_COMMANDS_REMOVEITEMSCOMMAND_H
+#define MVVM_COMMANDS_REMOVEITEMSCOMMAND_H
+
+#include "mvvm/commands/abstractitemcommand.h"
+
+namespace ModelView {
+
+class SessionItem;
+class TagRow;
+
+//! Command for undo/redo to remove range of items occupying consecutive rows of parent's tag.
+//! All items are saved into a single backup, listeners get one notification about the whole range.
+
+class MVVM_MODEL_EXPORT RemoveItemsCommand : public AbstractItemCommand {
+public:
+    RemoveItemsCommand(SessionItem* parent, const TagRow& tagrow, int count);
+    ~RemoveItemsCommand() override;
+
+    size_t memoryFootprint() const override;
+
+private:
+    void undo_command() override;
+    void execute_command() override;
+
+    struct RemoveItemsCommandImpl;
+    std::unique_ptr<RemoveItemsCommandImpl> p_impl;
+};
+
+} // namespace ModelView
+
+#endif // MVVM_COMMANDS_REMOVEITEMSCOMMAND_H
@@ -9,11 +9,12 @@
 
 #include "mvvm/commands/setvaluecommand.h"
 #include "mvvm/core/variant.h"
-#include "mvvm/model/path.h"
+#include "mvvm/model/customvariants.h"
 #include "mvvm/model/sessionitem.h"
 #include <sstream>
 
 namespace {
+const int set_value_command_id = 1;
 std::string generate_description(const std::string& str, int role);
 } // namespace
 
@@ -22,7 +23,7 @@ using namespace ModelView;
 struct SetValueCommand::SetValueCommandImpl {
     Variant m_value; //! Value to set as a result of command execution.
     int m_role;
-    Path m_item_path;
+    identifier_type m_item_identifier;
     SetValueCommandImpl(Variant value, int role) : m_value(std::move(value)), m_role(role) {}
 };
 
@@ -35,11 +36,38 @@ SetValueCommand::SetValueCommand(SessionItem* item, Variant value, int role)
     setResult(false);
 
     setDescription(generate_description(p_impl->m_value.toString().toStdString(), role));
-    p_impl->m_item_path = pathFromItem(item);
+    p_impl->m_item_identifier = item->identifier();
 }
 
 SetValueCommand::~SetValueCommand() = default;
 
+int SetValueCommand::id() const
+{
+    return set_value_command_id;
+}
+
+//! Merges command setting the value of the same item and role. Undo of the merged command will
+//! restore the value which item had before this command, the value of the other command will be
+//! picked up by swap_values during undo, so nothing has to be stored here.
+
+bool SetValueCommand::mergeWith(const AbstractItemCommand* other)
+{
+    auto command = dynamic_cast<const SetValueCommand*>(other);
+    if (!command || command->p_impl->m_role != p_impl->m_role
+        || command->p_impl->m_item_identifier != p_impl->m_item_identifier)
+        return false;
+
+    setDescription(command->description());
+    return true;
+}
+
+//! Returns estimated number of bytes held by the command, including stored value.
+
+size_t SetValueCommand::memoryFootprint() const
+{
+    return AbstractItemCommand::memoryFootprint() + Utils::VariantFootprint(p_impl->m_value);
+}
+
 void SetValueCommand::undo_command()
 {
     swap_values();
@@ -52,7 +80,7 @@ void SetValueCommand::execute_command()
 
 void SetValueCommand::swap_values()
 {
-    auto item = itemFromPath(p_impl->m_item_path);
+    auto item = itemFromIdentifier(p_impl->m_item_identifier);
     auto old = item->data<Variant>(p_impl->m_role);
     auto result = item->setData(p_impl->m_value, p_impl->m_role, /*direct*/ true);
     setResult(result);
@@ -24,6 +24,12 @@ public:
     SetValueCommand(SessionItem* item, Variant value, int role);
     ~SetValueCommand() override;
 
+    int id() const override;
+
+    bool mergeWith(const AbstractItemCommand* other) override;
+
+    size_t memoryFootprint() const override;
+
 private:
     void undo_command() override;
     void execute_command() override;
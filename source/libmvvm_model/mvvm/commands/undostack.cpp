@@ -9,13 +9,91 @@
 
 #include "mvvm/commands/undostack.h"
 #include "mvvm/commands/commandadapter.h"
+#include <algorithm>
+#include <chrono>
+#include <vector>
 
 using namespace ModelView;
 
+namespace {
+
+//! Returns all adapters composing given command (several, if command is a macro).
+std::vector<CommandAdapter*> adapters(const QUndoCommand* command)
+{
+    std::vector<CommandAdapter*> result;
+    // QUndoStack provides only const access to commands it owns
+    if (auto adapter = dynamic_cast<const CommandAdapter*>(command); adapter)
+        result.push_back(const_cast<CommandAdapter*>(adapter));
+    for (int index = 0; index < command->childCount(); ++index) {
+        auto children = adapters(command->child(index));
+        result.insert(result.end(), children.begin(), children.end());
+    }
+    return result;
+}
+
+} // namespace
+
 struct UndoStack::UndoStackImpl {
+    using clock_t = std::chrono::steady_clock;
+    size_t m_memory_usage{0}; //!< updated by adapters, so it has to outlive the stack
     std::unique_ptr<QUndoStack> m_undoStack;
+    std::chrono::milliseconds m_merge_interval{0};
+    clock_t::time_point m_last_execute;
+    int m_scope_depth{0};
+    bool m_scope_started{false}; //! no commands were executed in the current scope yet
+    size_t m_memory_limit{0};
+    int m_first_unreleased{0}; //!< index of the oldest command which wasn't released
     UndoStackImpl() : m_undoStack(std::make_unique<QUndoStack>()) {}
-    QUndoStack* undoStack() { return m_undoStack.get(); }
+    QUndoStack* undoStack() const { return m_undoStack.get(); }
+
+    //! Returns true if the command with given index was released.
+    bool is_released(int index) const
+    {
+        auto commands = adapters(undoStack()->command(index));
+        return !commands.empty() && commands.front()->isReleased();
+    }
+
+    //! Releases the oldest commands, until memory usage fits into the budget. The last executed
+    //! command is always kept. Released commands are skipped, they stay at the beginning of the
+    //! stack until it drops them due to undo limit.
+    void apply_memory_limit()
+    {
+        if (m_memory_limit == 0 || m_memory_usage <= m_memory_limit)
+            return;
+
+        // commands dropped from the beginning of the stack shift the border back
+        m_first_unreleased = std::min(m_first_unreleased, undoStack()->count());
+        while (m_first_unreleased > 0 && !is_released(m_first_unreleased - 1))
+            --m_first_unreleased;
+
+        for (; m_first_unreleased < undoStack()->index() - 1 && m_memory_usage > m_memory_limit;
+             ++m_first_unreleased)
+            for (auto adapter : adapters(undoStack()->command(m_first_unreleased)))
+                adapter->release();
+    }
+
+    //! Returns true if the command, which is next to undo, wasn't released.
+    bool can_undo() const
+    {
+        if (!undoStack()->canUndo())
+            return false;
+        auto commands = adapters(undoStack()->command(undoStack()->index() - 1));
+        return commands.empty() || !commands.front()->isReleased();
+    }
+
+    //! Returns true if command executed now is allowed to be merged into the previous one.
+    bool is_mergeable()
+    {
+        auto now = clock_t::now();
+        bool result{false};
+        if (m_scope_depth > 0)
+            result = !m_scope_started;
+        else if (m_merge_interval.count() > 0)
+            result = now - m_last_execute <= m_merge_interval;
+        m_last_execute = now;
+        m_scope_started = false;
+        return result;
+    }
 };
 
 UndoStack::UndoStack() : p_impl(std::make_unique<UndoStackImpl>()) {}
@@ -23,8 +101,10 @@ UndoStack::UndoStack() : p_impl(std::make_unique<UndoStackImpl>()) {}
 void UndoStack::execute(std::shared_ptr<AbstractItemCommand> command)
 {
     // Wrapping command for Qt. It will be executed by Qt after push.
-    auto adapter = new CommandAdapter(std::move(command));
+    auto adapter = new CommandAdapter(std::move(command), p_impl->is_mergeable(),
+                                      &p_impl->m_memory_usage);
     p_impl->undoStack()->push(adapter);
+    p_impl->apply_memory_limit();
 }
 
 UndoStack::~UndoStack() = default;
@@ -36,7 +116,7 @@ bool UndoStack::isActive() const
 
 bool UndoStack::canUndo() const
 {
-    return p_impl->undoStack()->canUndo();
+    return p_impl->can_undo();
 }
 
 bool UndoStack::canRedo() const
@@ -56,7 +136,8 @@ int UndoStack::count() const
 
 void UndoStack::undo()
 {
-    return p_impl->undoStack()->undo();
+    if (p_impl->can_undo())
+        p_impl->undoStack()->undo();
 }
 
 void UndoStack::redo()
@@ -66,7 +147,8 @@ void UndoStack::redo()
 
 void UndoStack::clear()
 {
-    return p_impl->undoStack()->clear();
+    p_impl->undoStack()->clear();
+    p_impl->m_first_unreleased = 0;
 }
 
 void UndoStack::setUndoLimit(int limit)
@@ -93,4 +175,33 @@ void UndoStack::beginMacro(const std::string& name)
 void UndoStack::endMacro()
 {
     p_impl->undoStack()->endMacro();
+    p_impl->apply_memory_limit();
+}
+
+void UndoStack::setMergeInterval(int msec)
+{
+    p_impl->m_merge_interval = std::chrono::milliseconds(msec);
+}
+
+void UndoStack::beginMergeScope()
+{
+    if (p_impl->m_scope_depth++ == 0)
+        p_impl->m_scope_started = true;
+}
+
+void UndoStack::endMergeScope()
+{
+    if (p_impl->m_scope_depth > 0)
+        --p_impl->m_scope_depth;
+}
+
+void UndoStack::setMemoryLimit(size_t bytes)
+{
+    p_impl->m_memory_limit = bytes;
+    p_impl->apply_memory_limit();
+}
+
+size_t UndoStack::memoryUsage() const
+{
+    return p_impl->m_memory_usage;
 }
@@ -45,6 +45,13 @@ public:
     void beginMacro(const std::string& name) override;
     void endMacro() override;
 
+    void setMergeInterval(int msec) override;
+    void beginMergeScope() override;
+    void endMergeScope() override;
+
+    void setMemoryLimit(size_t bytes) override;
+    size_t memoryUsage() const override;
+
 private:
     struct UndoStackImpl;
     std::unique_ptr<UndoStackImpl> p_impl;
@@ -0,0 +1,73 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/core/symbol.h"
+#include <mutex>
+#include <unordered_set>
+
+using namespace ModelView;
+
+namespace {
+
+const std::string* empty_string()
+{
+    static const std::string result;
+    return &result;
+}
+
+//! Process-wide table of interned strings. Node based set keeps string addresses stable.
+class SymbolTable {
+public:
+    static SymbolTable& instance()
+    {
+        static SymbolTable table;
+        return table;
+    }
+
+    const std::string* intern(const std::string& str)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return &*m_strings.insert(str).first;
+    }
+
+    const std::string* find(const std::string& str) const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_strings.find(str);
+        return it == m_strings.end() ? nullptr : &*it;
+    }
+
+private:
+    mutable std::mutex m_mutex;
+    std::unordered_set<std::string> m_strings;
+};
+
+} // namespace
+
+//! Constructs empty symbol.
+
+Symbol::Symbol() : m_str(empty_string()) {}
+
+//! Constructs symbol for given string, interning the string on first use.
+
+Symbol::Symbol(const std::string& str)
+    : m_str(str.empty() ? empty_string() : SymbolTable::instance().intern(str))
+{
+}
+
+//! Returns symbol for given string if it was already interned, and empty symbol otherwise.
+//! Unlike constructor, never grows the table.
+
+Symbol Symbol::find(const std::string& str)
+{
+    Symbol result;
+    if (auto interned = str.empty() ? nullptr : SymbolTable::instance().find(str); interned)
+        result.m_str = interned;
+    return result;
+}
@@ -0,0 +1,54 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_CORE_SYMBOL_H
+#define MVVM_CORE_SYMBOL_H
+
+#include "mvvm/model_export.h"
+#include <cstdint>
+#include <functional>
+#include <string>
+
+namespace ModelView {
+
+//! Handle to the string interned in the process-wide symbol table.
+
+//! Symbols with the same content point to the same string, so copying, comparison and hashing
+//! are pointer operations. Interned strings live until the end of the program. Symbols are meant
+//! for strings with small number of distinct values, like model types.
+
+class MVVM_MODEL_EXPORT Symbol {
+public:
+    Symbol();
+    explicit Symbol(const std::string& str);
+
+    static Symbol find(const std::string& str);
+
+    const std::string& str() const { return *m_str; }
+
+    bool empty() const { return m_str->empty(); }
+
+    size_t hash() const { return std::hash<const std::string*>()(m_str); }
+
+    bool operator==(const Symbol& other) const { return m_str == other.m_str; }
+    bool operator!=(const Symbol& other) const { return m_str != other.m_str; }
+
+private:
+    const std::string* m_str;
+};
+
+} // namespace ModelView
+
+namespace std {
+template <> struct hash<ModelView::Symbol> {
+    size_t operator()(const ModelView::Symbol& symbol) const { return symbol.hash(); }
+};
+} // namespace std
+
+#endif // MVVM_CORE_SYMBOL_H
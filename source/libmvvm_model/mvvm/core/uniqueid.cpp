@@ -0,0 +1,137 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/core/uniqueid.h"
+#include <tuple>
+
+using namespace ModelView;
+
+namespace {
+
+const size_t canonical_length = 38; // "{67c8770b-44f1-410a-ab9a-f9b5446f13ee}"
+const char hex_digits[] = "0123456789abcdef";
+
+bool is_dash_position(size_t pos)
+{
+    return pos == 9 || pos == 14 || pos == 19 || pos == 24;
+}
+
+//! Returns value of lower case hex digit, or -1 if character is not a lower case hex digit.
+int hex_value(char ch)
+{
+    if (ch >= '0' && ch <= '9')
+        return ch - '0';
+    if (ch >= 'a' && ch <= 'f')
+        return ch - 'a' + 10;
+    return -1;
+}
+
+//! Final mixing step of splitmix64 generator.
+uint64_t mix(uint64_t x)
+{
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+//! FNV-1a hash of the string with given offset basis.
+uint64_t fnv1a(const std::string& str, uint64_t basis)
+{
+    uint64_t result = basis;
+    for (auto ch : str) {
+        result ^= static_cast<unsigned char>(ch);
+        result *= 0x100000001b3ULL;
+    }
+    return result;
+}
+
+} // namespace
+
+UniqueId::UniqueId(uint64_t high, uint64_t low) : m_high(high), m_low(low) {}
+
+//! Creates identifier from its string representation. Canonical UUID strings are converted
+//! without loss, all other strings are hashed.
+
+UniqueId UniqueId::fromString(const identifier_type& str)
+{
+    if (!isCanonical(str))
+        return {mix(fnv1a(str, 0xcbf29ce484222325ULL)), mix(fnv1a(str, 0x84222325cbf29ce4ULL))};
+
+    uint64_t high{0}, low{0};
+    int nibbles{0};
+    for (size_t pos = 1; pos + 1 < canonical_length; ++pos) {
+        if (is_dash_position(pos))
+            continue;
+        auto& target = nibbles < 16 ? high : low;
+        target = (target << 4) | static_cast<uint64_t>(hex_value(str[pos]));
+        ++nibbles;
+    }
+    return {high, low};
+}
+
+//! Returns true if given string has canonical UUID form, as generated by QUuid.
+
+bool UniqueId::isCanonical(const identifier_type& str)
+{
+    if (str.size() != canonical_length || str.front() != '{' || str.back() != '}')
+        return false;
+
+    for (size_t pos = 1; pos + 1 < canonical_length; ++pos) {
+        if (is_dash_position(pos) ? str[pos] != '-' : hex_value(str[pos]) < 0)
+            return false;
+    }
+    return true;
+}
+
+//! Returns identifier in canonical UUID form.
+
+std::string UniqueId::toString() const
+{
+    std::string result(canonical_length, '-');
+    result.front() = '{';
+    result.back() = '}';
+
+    int nibble{31};
+    for (size_t pos = 1; pos + 1 < canonical_length; ++pos) {
+        if (is_dash_position(pos))
+            continue;
+        auto source = nibble >= 16 ? m_high : m_low;
+        result[pos] = hex_digits[(source >> (4 * (nibble % 16))) & 0xf];
+        --nibble;
+    }
+    return result;
+}
+
+bool UniqueId::isNull() const
+{
+    return m_high == 0 && m_low == 0;
+}
+
+//! Returns hash value suitable for open addressing tables. Identifiers coming from sequential
+//! generators differ only in few bits, so both halves are mixed.
+
+size_t UniqueId::hash() const
+{
+    return static_cast<size_t>(mix(m_high ^ mix(m_low)));
+}
+
+bool UniqueId::operator==(const UniqueId& other) const
+{
+    return m_high == other.m_high && m_low == other.m_low;
+}
+
+bool UniqueId::operator!=(const UniqueId& other) const
+{
+    return !(*this == other);
+}
+
+bool UniqueId::operator<(const UniqueId& other) const
+{
+    return std::tie(m_high, m_low) < std::tie(other.m_high, other.m_low);
+}
@@ -0,0 +1,63 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_CORE_UNIQUEID_H
+#define MVVM_CORE_UNIQUEID_H
+
+#include "mvvm/core/types.h"
+#include "mvvm/model_export.h"
+#include <cstdint>
+#include <functional>
+
+namespace ModelView {
+
+//! Compact 128-bit representation of SessionItem identifier.
+
+//! Identifiers are stored as strings in item's data and in serialized files, while internal
+//! lookup tables (i.e. ItemPool) use this binary form. Identifiers in canonical UUID form
+//! "{xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx}" (lower case hex digits) are converted without loss.
+//! Any other string is hashed into 128 bits; such identifiers are marked as non-canonical, and the
+//! user is responsible for keeping the original string.
+
+class MVVM_MODEL_EXPORT UniqueId {
+public:
+    UniqueId() = default;
+    UniqueId(uint64_t high, uint64_t low);
+
+    static UniqueId fromString(const identifier_type& str);
+
+    static bool isCanonical(const identifier_type& str);
+
+    std::string toString() const;
+
+    uint64_t high() const { return m_high; }
+    uint64_t low() const { return m_low; }
+
+    bool isNull() const;
+
+    size_t hash() const;
+
+    bool operator==(const UniqueId& other) const;
+    bool operator!=(const UniqueId& other) const;
+    bool operator<(const UniqueId& other) const;
+
+private:
+    uint64_t m_high{0};
+    uint64_t m_low{0};
+};
+
+} // namespace ModelView
+
+namespace std {
+template <> struct hash<ModelView::UniqueId> {
+    size_t operator()(const ModelView::UniqueId& id) const { return id.hash(); }
+};
+} // namespace std
+
+#endif // MVVM_CORE_UNIQUEID_H
@@ -9,10 +9,84 @@
 
 #include "mvvm/core/uniqueidgenerator.h"
 #include <QUuid>
+#include <chrono>
+#include <random>
 
 using namespace ModelView;
 
+namespace {
+
+const uint64_t version_mask = 0xf000ULL;
+const uint64_t version_4 = 0x4000ULL;
+const uint64_t variant_mask = 0xc000000000000000ULL;
+const uint64_t variant_rfc4122 = 0x8000000000000000ULL;
+
+uint64_t random_seed()
+{
+    std::random_device device;
+    uint64_t result = (static_cast<uint64_t>(device()) << 32) ^ device();
+    // protection against deterministic random_device implementations
+    result ^= static_cast<uint64_t>(
+        std::chrono::high_resolution_clock::now().time_since_epoch().count());
+    return result;
+}
+
+//! Returns storage for current generation strategy. Default strategy is created on first use.
+UniqueIdGenerator::generator_t& current_generator()
+{
+    static UniqueIdGenerator::generator_t generator = SequentialIdGenerator();
+    return generator;
+}
+
+} // namespace
+
+SequentialIdGenerator::SequentialIdGenerator() : SequentialIdGenerator(random_seed()) {}
+
+SequentialIdGenerator::SequentialIdGenerator(uint64_t seed)
+    : m_seed((seed & ~version_mask) | version_4)
+    , m_counter(std::make_shared<std::atomic<uint64_t>>(0))
+{
+}
+
+//! Returns next identifier of the sequence. Thread safe.
+
+UniqueId SequentialIdGenerator::operator()() const
+{
+    auto count = m_counter->fetch_add(1, std::memory_order_relaxed);
+    return {m_seed, (count & ~variant_mask) | variant_rfc4122};
+}
+
+//! Returns new identifier in the string form.
+
 identifier_type UniqueIdGenerator::generate()
 {
-    return QUuid::createUuid().toString().toStdString();
+    return generateId().toString();
+}
+
+//! Returns new identifier in the binary form.
+
+UniqueId UniqueIdGenerator::generateId()
+{
+    return current_generator()();
+}
+
+//! Sets generation strategy. Empty function restores default strategy.
+//! Shouldn't be called while other threads are generating identifiers.
+
+void UniqueIdGenerator::setGenerator(generator_t generator)
+{
+    current_generator() = generator ? std::move(generator) : SequentialIdGenerator();
+}
+
+//! Generation strategy based on random QUuid (version 4). Much slower than default strategy.
+
+UniqueId UniqueIdGenerator::createUuid()
+{
+    auto uuid = QUuid::createUuid();
+    uint64_t high = (static_cast<uint64_t>(uuid.data1) << 32)
+                    | (static_cast<uint64_t>(uuid.data2) << 16) | uuid.data3;
+    uint64_t low{0};
+    for (auto byte : uuid.data4)
+        low = (low << 8) | byte;
+    return {high, low};
 }
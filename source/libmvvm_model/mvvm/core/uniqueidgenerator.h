@@ -11,20 +11,50 @@
 #define MVVM_CORE_UNIQUEIDGENERATOR_H
 
 #include "mvvm/core/types.h"
+#include "mvvm/core/uniqueid.h"
 #include "mvvm/model_export.h"
+#include <atomic>
+#include <functional>
+#include <memory>
 
 namespace ModelView {
 
+//! Generates identifiers from a random 64-bit seed and a monotonic counter.
+
+//! Generated identifiers have the form of version 4 UUID, so they can be mixed freely with
+//! identifiers loaded from older project files. Default-constructed generator takes a random seed,
+//! which makes identifiers unique across processes. Copies of the generator share the same counter.
+
+class MVVM_MODEL_EXPORT SequentialIdGenerator {
+public:
+    SequentialIdGenerator();
+    explicit SequentialIdGenerator(uint64_t seed);
+
+    UniqueId operator()() const;
+
+private:
+    uint64_t m_seed{0};
+    std::shared_ptr<std::atomic<uint64_t>> m_counter;
+};
+
 //! Provides generation of unique SessionItem identifier.
 
-//! In the future might be turned to singleton to keep track of all generated identifier
-//! and make sure, that SessionItem identifiers loaded from disk, are different from those
-//! generated during a dynamic session. For the moment though, we rely on zero-probability of
-//! such event.
+//! Generation strategy can be replaced with setGenerator(). By default, a process-wide
+//! SequentialIdGenerator is used, which is considerably faster than QUuid. For the moment we rely
+//! on zero-probability of clashes between identifiers generated in a dynamic session and those
+//! loaded from disk.
 
 class MVVM_MODEL_EXPORT UniqueIdGenerator {
 public:
+    using generator_t = std::function<UniqueId()>;
+
     static identifier_type generate();
+
+    static UniqueId generateId();
+
+    static void setGenerator(generator_t generator);
+
+    static UniqueId createUuid();
 };
 
 } // namespace ModelView
@@ -10,24 +10,22 @@
 #ifndef MVVM_INTERFACES_ITEMBACKUPSTRATEGY_H
 #define MVVM_INTERFACES_ITEMBACKUPSTRATEGY_H
 
-#include "mvvm/model_export.h"
-#include <memory>
+#include "mvvm/interfaces/itemkeepstrategy.h"
 
 namespace ModelView {
 
 class SessionItem;
 
-//! Interface to backup items for later restore.
+//! Interface to backup items for later restore. Besides items removed from the model, it can save
+//! the content of items which stay where they are.
 
-class MVVM_MODEL_EXPORT ItemBackupStrategy {
+class MVVM_MODEL_EXPORT ItemBackupStrategy : public ItemKeepStrategy {
 public:
-    virtual ~ItemBackupStrategy() = default;
-
-    //! Restore item from saved content.
-    virtual std::unique_ptr<SessionItem> restoreItem() const = 0;
-
-    //! Save item's content.
+    //! Save item's content, restored via restoreItem.
     virtual void saveItem(const SessionItem*) = 0;
+
+    //! Save content of several items into single backup, restored via restoreItems.
+    virtual void saveItems(const std::vector<const SessionItem*>& items) = 0;
 };
 
 } // namespace ModelView
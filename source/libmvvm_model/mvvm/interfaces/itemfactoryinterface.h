@@ -29,6 +29,12 @@ public:
                               const std::string& label) = 0;
 
     virtual std::unique_ptr<SessionItem> createItem(const model_type& modelType) const = 0;
+
+    //! Returns deep copy of the item made without serialization, or nullptr if the item can't be
+    //! copied this way. Only types which opt in by declaring stamp constructor (see ItemStampTag)
+    //! are copied natively. Identifiers are regenerated unless `preserve_identifiers` is set.
+    virtual std::unique_ptr<SessionItem> cloneItem(const SessionItem& item,
+                                                   bool preserve_identifiers) const = 0;
 };
 
 } // namespace ModelView
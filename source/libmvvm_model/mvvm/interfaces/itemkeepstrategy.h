@@ -0,0 +1,47 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_INTERFACES_ITEMKEEPSTRATEGY_H
+#define MVVM_INTERFACES_ITEMKEEPSTRATEGY_H
+
+#include "mvvm/model_export.h"
+#include <memory>
+#include <vector>
+
+namespace ModelView {
+
+class SessionItem;
+
+//! Interface to keep items removed from the model for later restore.
+
+class MVVM_MODEL_EXPORT ItemKeepStrategy {
+public:
+    virtual ~ItemKeepStrategy() = default;
+
+    //! Restore item from kept content.
+    virtual std::unique_ptr<SessionItem> restoreItem() = 0;
+
+    //! Restore all items from content kept by keepItems.
+    virtual std::vector<std::unique_ptr<SessionItem>> restoreItems() = 0;
+
+    //! Takes ownership of the item just removed from the model. Its content should be available
+    //! via restoreItem.
+    virtual void keepItem(std::unique_ptr<SessionItem> item) = 0;
+
+    //! Takes ownership of several items just removed from the model. Their content should be
+    //! available via restoreItems.
+    virtual void keepItems(std::vector<std::unique_ptr<SessionItem>> items) = 0;
+
+    //! Returns estimated number of bytes occupied by kept content.
+    virtual size_t memoryFootprint() const = 0;
+};
+
+} // namespace ModelView
+
+#endif // MVVM_INTERFACES_ITEMKEEPSTRATEGY_H
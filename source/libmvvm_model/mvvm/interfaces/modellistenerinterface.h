@@ -22,29 +22,58 @@ public:
 
     //! Sets callback to be notified on item's data change. The callback will be called
     //! with (SessionItem*, data_role).
-    virtual void setOnDataChange(Callbacks::item_int_t f, Callbacks::slot_t client) = 0;
+    virtual SignalConnection setOnDataChange(Callbacks::item_int_t f, Callbacks::slot_t client) = 0;
 
     //! Sets callback to be notified on item insert. The callback will be called with
     //! (SessionItem* parent, tagrow), where 'tagrow' denotes inserted child position.
-    virtual void setOnItemInserted(Callbacks::item_tagrow_t f, Callbacks::slot_t client) = 0;
+    virtual SignalConnection setOnItemInserted(Callbacks::item_tagrow_t f,
+                                               Callbacks::slot_t client) = 0;
 
     //! Sets callback to be notified on item remove. The callback will be called with
     //! (SessionItem* parent, tagrow), where 'tagrow' denotes child position before the removal.
-    virtual void setOnItemRemoved(Callbacks::item_tagrow_t f, Callbacks::slot_t client) = 0;
+    virtual SignalConnection setOnItemRemoved(Callbacks::item_tagrow_t f,
+                                              Callbacks::slot_t client) = 0;
 
     //! Sets callback to be notified when the item is about to be removed. The callback will be
     //! called with (SessionItem* parent, tagrow), where 'tagrow' denotes child position being
     //! removed.
-    virtual void setOnAboutToRemoveItem(Callbacks::item_tagrow_t f, Callbacks::slot_t client) = 0;
+    virtual SignalConnection setOnAboutToRemoveItem(Callbacks::item_tagrow_t f,
+                                                    Callbacks::slot_t client) = 0;
+
+    //! Sets callback to be notified on insert of the range of items. The callback will be called
+    //! with (SessionItem* parent, tagrow, count), where 'tagrow' denotes position of the first
+    //! inserted child. Inside the batch adjacent insertions are merged into single range.
+    virtual SignalConnection setOnItemsInserted(Callbacks::item_range_t f,
+                                                Callbacks::slot_t client) = 0;
+
+    //! Sets callback to be notified on removal of the range of items. The callback will be called
+    //! with (SessionItem* parent, tagrow, count), where 'tagrow' denotes position of the first
+    //! removed child before the removal. Inside the batch adjacent removals are merged.
+    virtual SignalConnection setOnItemsRemoved(Callbacks::item_range_t f,
+                                               Callbacks::slot_t client) = 0;
+
+    //! Sets callback to be notified when the range of items is about to be removed. The callback
+    //! will be called with (SessionItem* parent, tagrow, count), where 'tagrow' denotes position of
+    //! the first child being removed. Removal of the single item is reported as range of one.
+    virtual SignalConnection setOnAboutToRemoveItems(Callbacks::item_range_t f,
+                                                     Callbacks::slot_t client) = 0;
+
+    //! Sets the callback to be notified when the outermost batch of changes is finished.
+    virtual SignalConnection setOnBatchFinished(Callbacks::model_t f, Callbacks::slot_t client) = 0;
 
     //! Sets the callback for notifications on model destruction.
-    virtual void setOnModelDestroyed(Callbacks::model_t f, Callbacks::slot_t client) = 0;
+    virtual SignalConnection setOnModelDestroyed(Callbacks::model_t f,
+                                                 Callbacks::slot_t client) = 0;
 
     //! Sets the callback to be notified just before the reset of the root item.
-    virtual void setOnModelAboutToBeReset(Callbacks::model_t f, Callbacks::slot_t client) = 0;
+    virtual SignalConnection setOnModelAboutToBeReset(Callbacks::model_t f,
+                                                      Callbacks::slot_t client) = 0;
 
     //! Sets the callback to be notified right after the root item recreation.
-    virtual void setOnModelReset(Callbacks::model_t f, Callbacks::slot_t client) = 0;
+    virtual SignalConnection setOnModelReset(Callbacks::model_t f, Callbacks::slot_t client) = 0;
+
+    //! Disconnects single callback using the handle returned on subscription.
+    virtual void disconnect(SignalConnection connection) = 0;
 
     //! Removes given client from all subscriptions.
     virtual void unsubscribe(Callbacks::slot_t client) = 0;
@@ -44,6 +44,22 @@ public:
 
     virtual void beginMacro(const std::string& name) = 0;
     virtual void endMacro() = 0;
+
+    //! Sets time interval in msec, within which successive commands changing the value of the same
+    //! item and role are merged together. Zero interval disables merging by time.
+    virtual void setMergeInterval(int msec) = 0;
+
+    //! Starts interaction scope (e.g. dragging of a slider): successive commands changing the value
+    //! of the same item and role are merged together until the end of the scope.
+    virtual void beginMergeScope() = 0;
+    virtual void endMergeScope() = 0;
+
+    //! Sets memory budget in bytes. When commands in the stack hold more memory, the oldest
+    //! commands are released and can't be undone anymore. Zero budget means no limit.
+    virtual void setMemoryLimit(size_t bytes) = 0;
+
+    //! Returns estimated number of bytes held by commands in the stack.
+    virtual size_t memoryUsage() const = 0;
 };
 
 } // namespace ModelView
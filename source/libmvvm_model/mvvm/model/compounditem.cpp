@@ -21,6 +21,11 @@ bool has_custom_display_name(const SessionItem* item)
 
 CompoundItem::CompoundItem(const std::string& modelType) : SessionItem(modelType) {}
 
+CompoundItem::CompoundItem(const CompoundItem& prototype, ItemStampTag tag)
+    : SessionItem(prototype, tag)
+{
+}
+
 std::string CompoundItem::displayName() const
 {
     if (has_custom_display_name(this))
@@ -23,6 +23,7 @@ namespace ModelView {
 class MVVM_MODEL_EXPORT CompoundItem : public SessionItem {
 public:
     CompoundItem(const std::string& modelType = Constants::CompoundItemType);
+    CompoundItem(const CompoundItem& prototype, ItemStampTag tag);
 
     //! Adds property item of given type.
     template <typename T = PropertyItem> T* addProperty(const std::string& name);
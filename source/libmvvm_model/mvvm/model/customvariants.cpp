@@ -35,11 +35,17 @@ bool Utils::CompatibleVariantTypes(const Variant& oldValue, const Variant& newVa
 {
     // Invalid variant can be rewritten by any variant.
     // Valid Variant can be replaced by invalid variant.
+    // Arrays of doubles are interchangeable, to be able to load std::vector<double> based data
+    // into properties which are DoubleArray based now.
     // In other cases types of variants should coincide to be compatible.
 
     if (!oldValue.isValid() || !newValue.isValid())
         return true;
 
+    if ((IsDoubleArrayVariant(oldValue) || IsDoubleVectorVariant(oldValue))
+        && (IsDoubleArrayVariant(newValue) || IsDoubleVectorVariant(newValue)))
+        return true;
+
     return Utils::VariantType(oldValue) == Utils::VariantType(newValue);
 }
 
@@ -67,6 +73,10 @@ Variant Utils::toQtVariant(const Variant& custom)
             QString("vector of %1 elements").arg(custom.value<std::vector<double>>().size());
         return Variant(str);
     }
+    else if (IsDoubleArrayVariant(custom)) {
+        QString str = QString("vector of %1 elements").arg(custom.value<DoubleArray>().size());
+        return Variant(str);
+    }
 
     // in other cases returns unchanged variant
     return custom;
@@ -115,6 +125,20 @@ bool Utils::IsDoubleVectorVariant(const Variant& variant)
     return variant.typeName() == Constants::vector_double_type_name;
 }
 
+bool Utils::IsDoubleArrayVariant(const Variant& variant)
+{
+    return variant.typeName() == Constants::double_array_type_name;
+}
+
+DoubleArray Utils::toDoubleArray(const Variant& variant)
+{
+    if (IsDoubleArrayVariant(variant))
+        return variant.value<DoubleArray>();
+    if (IsDoubleVectorVariant(variant))
+        return DoubleArray(variant.value<std::vector<double>>());
+    return {};
+}
+
 bool Utils::IsColorVariant(const Variant& variant)
 {
     return variant.type() == Variant::Color;
@@ -129,3 +153,20 @@ bool Utils::IsRealLimitsVariant(const Variant& variant)
 {
     return variant.canConvert<RealLimits>();
 }
+
+//! Arrays of doubles and strings are counted by their size, other values by the size of variant.
+//! Buffers shared between several copies of DoubleArray are counted in full.
+
+size_t Utils::VariantFootprint(const Variant& variant)
+{
+    size_t result = sizeof(Variant);
+    if (IsDoubleArrayVariant(variant))
+        result += variant.value<DoubleArray>().size() * sizeof(double);
+    else if (IsDoubleVectorVariant(variant))
+        result += variant.value<std::vector<double>>().size() * sizeof(double);
+    else if (variant.userType() == qMetaTypeId<std::string>())
+        result += variant.value<std::string>().size();
+    else if (variant.type() == QVariant::String)
+        result += static_cast<size_t>(variant.toString().size()) * sizeof(QChar);
+    return result;
+}
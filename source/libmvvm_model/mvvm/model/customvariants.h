@@ -14,6 +14,7 @@
 //! Registrations and translations for custom variants.
 
 #include "mvvm/core/variant.h"
+#include "mvvm/model/doublearray.h"
 #include "mvvm/model_export.h"
 #include "mvvm/utils/reallimits.h"
 #include <QMetaType>
@@ -58,6 +59,12 @@ MVVM_MODEL_EXPORT bool IsStdStringVariant(const Variant& variant);
 //! Returns true in the case of variant based on std::vector<double>.
 MVVM_MODEL_EXPORT bool IsDoubleVectorVariant(const Variant& variant);
 
+//! Returns true in the case of variant based on DoubleArray.
+MVVM_MODEL_EXPORT bool IsDoubleArrayVariant(const Variant& variant);
+
+//! Returns array of doubles stored in variant (DoubleArray or std::vector<double> based).
+MVVM_MODEL_EXPORT DoubleArray toDoubleArray(const Variant& variant);
+
 //! Returns true in the case of QColor based variant.
 MVVM_MODEL_EXPORT bool IsColorVariant(const Variant& variant);
 
@@ -67,6 +74,9 @@ MVVM_MODEL_EXPORT bool IsExtPropertyVariant(const Variant& variant);
 //! Returns true in the case of RealLimits based variant.
 MVVM_MODEL_EXPORT bool IsRealLimitsVariant(const Variant& variant);
 
+//! Returns estimated number of bytes occupied by the variant together with its content.
+MVVM_MODEL_EXPORT size_t VariantFootprint(const Variant& variant);
+
 } // namespace ModelView::Utils
 
 Q_DECLARE_METATYPE(std::string)
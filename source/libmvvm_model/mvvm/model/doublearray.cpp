@@ -0,0 +1,110 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/model/doublearray.h"
+#include <algorithm>
+#include <cassert>
+
+using namespace ModelView;
+
+namespace {
+//! Returns buffer shared by all default-constructed arrays.
+const std::shared_ptr<std::vector<double>>& empty_buffer()
+{
+    static const auto result = std::make_shared<std::vector<double>>();
+    return result;
+}
+} // namespace
+
+//! Creates empty array. All empty arrays refer to the same buffer, no allocation takes place.
+
+DoubleArray::DoubleArray() : m_data(empty_buffer()) {}
+
+//! Creates array taking ownership of the data.
+
+DoubleArray::DoubleArray(std::vector<double> data)
+    : m_data(std::make_shared<std::vector<double>>(std::move(data)))
+{
+}
+
+size_t DoubleArray::size() const
+{
+    return m_data ? m_data->size() : 0;
+}
+
+bool DoubleArray::empty() const
+{
+    return size() == 0;
+}
+
+//! Returns pointer to the first element (nullptr for empty array).
+
+const double* DoubleArray::data() const
+{
+    return empty() ? nullptr : m_data->data();
+}
+
+DoubleArray::const_iterator DoubleArray::begin() const
+{
+    return data();
+}
+
+DoubleArray::const_iterator DoubleArray::end() const
+{
+    return data() + size();
+}
+
+double DoubleArray::operator[](size_t index) const
+{
+    assert(index < size());
+    return (*m_data)[index];
+}
+
+//! Returns copy of the data.
+
+std::vector<double> DoubleArray::toVector() const
+{
+    return m_data ? *m_data : std::vector<double>();
+}
+
+//! Returns buffer for modification. If the buffer is shared with other arrays, it is copied first,
+//! so other arrays are not affected.
+
+std::vector<double>& DoubleArray::mutableData()
+{
+    if (!m_data)
+        m_data = std::make_shared<std::vector<double>>();
+    else if (m_data.use_count() > 1)
+        m_data = std::make_shared<std::vector<double>>(*m_data);
+    return *m_data;
+}
+
+//! Returns true if both arrays refer to the same non-empty buffer.
+
+bool DoubleArray::isSharedWith(const DoubleArray& other) const
+{
+    return !empty() && m_data == other.m_data;
+}
+
+bool DoubleArray::operator==(const DoubleArray& other) const
+{
+    if (m_data == other.m_data)
+        return true;
+    return std::equal(begin(), end(), other.begin(), other.end());
+}
+
+bool DoubleArray::operator!=(const DoubleArray& other) const
+{
+    return !(*this == other);
+}
+
+bool DoubleArray::operator<(const DoubleArray& other) const
+{
+    return std::lexicographical_compare(begin(), end(), other.begin(), other.end());
+}
@@ -0,0 +1,60 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_MODEL_DOUBLEARRAY_H
+#define MVVM_MODEL_DOUBLEARRAY_H
+
+#include "mvvm/core/variant.h"
+#include "mvvm/model_export.h"
+#include <memory>
+#include <vector>
+
+namespace ModelView {
+
+//! Shared immutable array of doubles, intended for storing large data sets in SessionItem.
+
+//! Copies of the array share the same buffer, so it can travel between the model, undo stack,
+//! serialization and plotting without duplication. Read access is span-like. The buffer can't be
+//! changed via the shared handle; mutableData() detaches the array first if it is shared.
+
+class MVVM_MODEL_EXPORT DoubleArray {
+public:
+    using const_iterator = const double*;
+
+    DoubleArray();
+    explicit DoubleArray(std::vector<double> data);
+
+    size_t size() const;
+    bool empty() const;
+
+    const double* data() const;
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    double operator[](size_t index) const;
+
+    std::vector<double> toVector() const;
+
+    std::vector<double>& mutableData();
+
+    bool isSharedWith(const DoubleArray& other) const;
+
+    bool operator==(const DoubleArray& other) const;
+    bool operator!=(const DoubleArray& other) const;
+    bool operator<(const DoubleArray& other) const;
+
+private:
+    std::shared_ptr<std::vector<double>> m_data;
+};
+
+} // namespace ModelView
+
+Q_DECLARE_METATYPE(ModelView::DoubleArray)
+
+#endif // MVVM_MODEL_DOUBLEARRAY_H
@@ -16,6 +16,7 @@
 namespace ModelView {
 
 class SessionItem;
+class ItemStampTag;
 
 //! Definition for item factory funciton.
 using item_factory_func_t = std::function<std::unique_ptr<SessionItem>()>;
@@ -26,6 +27,19 @@ template <typename T> item_factory_func_t ItemFactoryFunction()
     return []() { return std::make_unique<T>(); };
 }
 
+//! Definition for function creating new item out of the prototype item of the same type.
+using item_clone_func_t =
+    std::function<std::unique_ptr<SessionItem>(const SessionItem&, const ItemStampTag&)>;
+
+//! Creates function stamping items of specific type out of the prototype. Uses stamp constructor
+//! of the item, which copies the data and tag layout, but not the children.
+template <typename T> item_clone_func_t ItemCloneFunction()
+{
+    return [](const SessionItem& prototype, const ItemStampTag& tag) {
+        return std::make_unique<T>(static_cast<const T&>(prototype), tag);
+    };
+}
+
 } // namespace ModelView
 
 #endif // MVVM_MODEL_FUNCTION_TYPES_H
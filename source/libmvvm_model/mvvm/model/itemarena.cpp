@@ -0,0 +1,182 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/model/itemarena.h"
+#include <array>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+using namespace ModelView;
+
+namespace {
+
+const size_t granularity = 16;
+const size_t max_block_size = 512; // larger objects go to the heap
+const size_t size_class_count = max_block_size / granularity;
+const size_t chunk_size = 64 * 1024;
+
+thread_local ItemArena* current_arena = nullptr;
+
+} // namespace
+
+//! Chunks and free lists of the arena. Lives until the arena and all its blocks are destroyed.
+
+struct ItemArena::ArenaStorage {
+    //! Header in front of every block. Heap blocks have nullptr storage.
+    struct alignas(granularity) BlockHeader {
+        ArenaStorage* storage{nullptr};
+        size_t size_class{0};
+    };
+
+    struct FreeBlock {
+        FreeBlock* next{nullptr};
+    };
+
+    mutable std::mutex m_mutex; // items can be destroyed from another thread
+    std::vector<std::unique_ptr<char[]>> m_chunks;
+    size_t m_chunk_used{chunk_size};
+    std::array<FreeBlock*, size_class_count> m_free_blocks{};
+    size_t m_block_count{0};
+    bool m_has_owner{true};
+
+    //! Returns memory for the header and the block of given size class.
+    void* allocate(size_t size_class)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++m_block_count;
+
+        if (auto block = m_free_blocks[size_class]; block) {
+            m_free_blocks[size_class] = block->next;
+            return block;
+        }
+
+        const size_t size = sizeof(BlockHeader) + (size_class + 1) * granularity;
+        if (m_chunk_used + size > chunk_size) {
+            m_chunks.emplace_back(new char[chunk_size]);
+            m_chunk_used = 0;
+        }
+        void* result = m_chunks.back().get() + m_chunk_used;
+        m_chunk_used += size;
+        return result;
+    }
+
+    //! Puts block back to the free list. Returns true if storage is not needed anymore.
+    bool deallocate(BlockHeader* header)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto block = reinterpret_cast<FreeBlock*>(header);
+        block->next = m_free_blocks[header->size_class];
+        m_free_blocks[header->size_class] = block;
+        --m_block_count;
+        return !m_has_owner && m_block_count == 0;
+    }
+
+    //! Detaches storage from its arena. Returns true if storage is not needed anymore.
+    bool release()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_has_owner = false;
+        return m_block_count == 0;
+    }
+
+    static BlockHeader* header(const void* ptr)
+    {
+        return static_cast<BlockHeader*>(const_cast<void*>(ptr)) - 1;
+    }
+};
+
+ItemArena::ItemArena() : m_storage(new ArenaStorage) {}
+
+ItemArena::~ItemArena()
+{
+    if (current_arena == this)
+        current_arena = nullptr;
+
+    if (m_storage->release())
+        delete m_storage;
+}
+
+//! Returns number of blocks currently allocated in the arena.
+
+size_t ItemArena::blockCount() const
+{
+    std::lock_guard<std::mutex> lock(m_storage->m_mutex);
+    return m_storage->m_block_count;
+}
+
+//! Returns size of memory reserved by the arena, in bytes.
+
+size_t ItemArena::reservedSize() const
+{
+    std::lock_guard<std::mutex> lock(m_storage->m_mutex);
+    return m_storage->m_chunks.size() * chunk_size;
+}
+
+//! Returns arena which is currently active for this thread, or nullptr.
+
+ItemArena* ItemArena::current()
+{
+    return current_arena;
+}
+
+//! Allocates memory in the current arena. Falls back to the heap if there is no current arena,
+//! or if requested size is too large.
+
+void* ItemArena::allocate(size_t size)
+{
+    using BlockHeader = ArenaStorage::BlockHeader;
+
+    BlockHeader* header{nullptr};
+    if (current_arena && size > 0 && size <= max_block_size) {
+        const size_t size_class = (size - 1) / granularity;
+        header = new (current_arena->m_storage->allocate(size_class)) BlockHeader;
+        header->storage = current_arena->m_storage;
+        header->size_class = size_class;
+    }
+    else {
+        header = new (::operator new(sizeof(BlockHeader) + size)) BlockHeader;
+    }
+    return header + 1;
+}
+
+//! Releases memory obtained with allocate().
+
+void ItemArena::deallocate(void* ptr)
+{
+    if (!ptr)
+        return;
+
+    auto header = ArenaStorage::header(ptr);
+    if (auto storage = header->storage; storage) {
+        if (storage->deallocate(header))
+            delete storage;
+    }
+    else {
+        ::operator delete(header);
+    }
+}
+
+//! Returns true if memory obtained with allocate() belongs to the given arena.
+
+bool ItemArena::isFromArena(const void* ptr, const ItemArena* arena)
+{
+    return ptr && arena && ArenaStorage::header(ptr)->storage == arena->m_storage;
+}
+
+ItemArena::Scope::Scope(ItemArena* arena) : m_previous(current_arena)
+{
+    current_arena = arena;
+}
+
+ItemArena::Scope::~Scope()
+{
+    current_arena = m_previous;
+}
@@ -0,0 +1,72 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_MODEL_ITEMARENA_H
+#define MVVM_MODEL_ITEMARENA_H
+
+#include "mvvm/model_export.h"
+#include <cstddef>
+
+namespace ModelView {
+
+//! Memory arena for SessionItem and its internal parts.
+
+//! Arena serves small fixed-size blocks out of large chunks, keeping items of one model close to
+//! each other in memory. Arena is activated for the current thread with ItemArena::Scope, all
+//! objects derived from ArenaAllocated which are created while the scope is alive go to the arena.
+//! Each block remembers its arena, so objects can be deleted at any time, even when the scope is
+//! gone. Chunks are released when both the arena and all its blocks are destroyed.
+
+class MVVM_MODEL_EXPORT ItemArena {
+public:
+    ItemArena();
+    ~ItemArena();
+    ItemArena(const ItemArena&) = delete;
+    ItemArena& operator=(const ItemArena&) = delete;
+
+    size_t blockCount() const;
+
+    size_t reservedSize() const;
+
+    static ItemArena* current();
+
+    static void* allocate(size_t size);
+    static void deallocate(void* ptr);
+
+    static bool isFromArena(const void* ptr, const ItemArena* arena);
+
+    //! Makes given arena current for the thread during the scope lifetime. Nullptr arena switches
+    //! allocations back to the heap.
+    class MVVM_MODEL_EXPORT Scope {
+    public:
+        explicit Scope(ItemArena* arena);
+        ~Scope();
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        ItemArena* m_previous{nullptr};
+    };
+
+private:
+    struct ArenaStorage;
+    ArenaStorage* m_storage{nullptr};
+};
+
+//! Base for classes which should be allocated in the current ItemArena, when there is one.
+
+class MVVM_MODEL_EXPORT ArenaAllocated {
+public:
+    static void* operator new(size_t size) { return ItemArena::allocate(size); }
+    static void operator delete(void* ptr) { ItemArena::deallocate(ptr); }
+};
+
+} // namespace ModelView
+
+#endif // MVVM_MODEL_ITEMARENA_H
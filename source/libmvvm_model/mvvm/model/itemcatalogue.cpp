@@ -8,9 +8,14 @@
 // ************************************************************************** //
 
 #include "mvvm/model/itemcatalogue.h"
+#include "mvvm/model/mvvm_types.h"
 #include "mvvm/model/sessionitem.h"
+#include "mvvm/model/sessionitemcontainer.h"
+#include "mvvm/model/sessionitemtags.h"
 #include "mvvm/utils/ifactory.h"
+#include <mutex>
 #include <stdexcept>
+#include <unordered_map>
 
 using namespace ModelView;
 
@@ -22,6 +27,85 @@ struct ItemCatalogue::ItemCatalogueImpl {
     };
 
     std::vector<TypeAndLabel> m_info;
+
+    struct CloneInfo {
+        item_clone_func_t clone;
+        std::type_index type;
+    };
+    std::unordered_map<std::string, CloneInfo> m_clone_info;
+    bool m_prototype_mode{false};
+
+    struct Prototype {
+        std::shared_ptr<const SessionItem> item;
+        bool is_stampable{false}; //!< all items of prototype's tree can be stamped
+    };
+    //! Prototypes are created on first request, the mutex makes create() safe to use from
+    //! several threads, as it is without prototypes.
+    mutable std::unordered_map<std::string, Prototype> m_prototypes;
+    mutable std::mutex m_prototypes_mutex;
+
+    ItemCatalogueImpl() = default;
+
+    //! Copies registrations, prototypes will be rebuilt on demand.
+    ItemCatalogueImpl(const ItemCatalogueImpl& other)
+        : factory(other.factory)
+        , m_info(other.m_info)
+        , m_clone_info(other.m_clone_info)
+        , m_prototype_mode(other.m_prototype_mode)
+    {
+    }
+
+    //! Returns true if item and all its children are of registered types with stamp constructors.
+    bool is_stampable(const SessionItem& item) const
+    {
+        auto it = m_clone_info.find(item.modelType());
+        if (it == m_clone_info.end() || it->second.type != std::type_index(typeid(item)))
+            return false;
+
+        for (auto child : item.childrenRange())
+            if (!is_stampable(*child))
+                return false;
+        return true;
+    }
+
+    //! Returns prototype for given model type, or nullptr if items of this type can't be stamped.
+    //! Prototype is shared, so it stays alive even if prototypes are released meanwhile.
+    std::shared_ptr<const SessionItem> find_prototype(const std::string& model_type) const
+    {
+        std::lock_guard<std::mutex> lock(m_prototypes_mutex);
+        auto it = m_prototypes.find(model_type);
+        if (it == m_prototypes.end()) {
+            Prototype prototype;
+            if (m_clone_info.find(model_type) != m_clone_info.end()) {
+                prototype.item = factory.create(model_type);
+                prototype.is_stampable = is_stampable(*prototype.item);
+            }
+            it = m_prototypes.emplace(model_type, std::move(prototype)).first;
+        }
+        return it->second.is_stampable ? it->second.item : nullptr;
+    }
+
+    //! Creates copy of the prototype's tree. Children are visited container by container, so the
+    //! prototype itself is never modified, not even its cached positions. Copies get their own
+    //! identifiers, unless `preserve_identifiers` is set.
+    std::unique_ptr<SessionItem> stamp(const SessionItem& prototype, const ItemStampTag& tag,
+                                       bool preserve_identifiers = false) const
+    {
+        auto result = m_clone_info.at(prototype.modelType()).clone(prototype, tag);
+        if (preserve_identifiers)
+            result->setData(prototype.identifier(), ItemDataRole::IDENTIFIER);
+
+        for (auto container : *prototype.itemTags()) {
+            int row{0};
+            for (auto child : *container) {
+                auto copy = stamp(*child, tag, preserve_identifiers);
+                if (!result->insertItem(copy.get(), {container->name(), row++}))
+                    throw std::runtime_error("ItemCatalogue -> Can't insert copy of child item");
+                copy.release();
+            }
+        }
+        return result;
+    }
 };
 
 ItemCatalogue::ItemCatalogue() : p_impl(std::make_unique<ItemCatalogueImpl>()) {}
@@ -56,9 +140,24 @@ bool ItemCatalogue::contains(const std::string& modelType) const
 
 std::unique_ptr<SessionItem> ItemCatalogue::create(const std::string& modelType) const
 {
+    if (p_impl->m_prototype_mode)
+        if (auto prototype = p_impl->find_prototype(modelType); prototype)
+            return p_impl->stamp(*prototype, ItemStampTag());
+
     return p_impl->factory.create(modelType);
 }
 
+//! Returns deep copy of the item made by stamp constructors of registered types, recursively for
+//! all children. If `preserve_identifiers` is false, all items of the copy get new identifiers.
+//! Returns nullptr if some item of the tree can't be stamped.
+
+std::unique_ptr<SessionItem> ItemCatalogue::clone(const SessionItem& item,
+                                                  bool preserve_identifiers) const
+{
+    return p_impl->is_stampable(item) ? p_impl->stamp(item, ItemStampTag(), preserve_identifiers)
+                                      : std::unique_ptr<SessionItem>();
+}
+
 std::vector<std::string> ItemCatalogue::modelTypes() const
 {
     std::vector<std::string> result;
@@ -93,4 +192,30 @@ void ItemCatalogue::merge(const ItemCatalogue& other)
         registerItem(it.first, it.second, other.p_impl->m_info[index].item_label);
         ++index;
     }
+
+    for (const auto& it : other.p_impl->m_clone_info)
+        p_impl->m_clone_info.emplace(it);
+}
+
+//! Enables creation of items by stamping them out of prototypes. Disabling the mode releases
+//! all prototypes.
+
+void ItemCatalogue::setPrototypeMode(bool value)
+{
+    p_impl->m_prototype_mode = value;
+    if (!value) {
+        std::lock_guard<std::mutex> lock(p_impl->m_prototypes_mutex);
+        p_impl->m_prototypes.clear();
+    }
+}
+
+bool ItemCatalogue::prototypeMode() const
+{
+    return p_impl->m_prototype_mode;
+}
+
+void ItemCatalogue::registerCloneFunction(const std::string& modelType, item_clone_func_t func,
+                                          std::type_index type)
+{
+    p_impl->m_clone_info.emplace(modelType, ItemCatalogueImpl::CloneInfo{std::move(func), type});
 }
@@ -13,6 +13,8 @@
 #include "mvvm/model/function_types.h"
 #include "mvvm/model_export.h"
 #include <string>
+#include <type_traits>
+#include <typeindex>
 #include <vector>
 
 namespace ModelView {
@@ -22,6 +24,15 @@ class SessionItem;
 //! Catalogue for item constructions. Contains collection of factory functions associated with
 //! item's modelType and optional label.
 
+//! In prototype mode, the catalogue keeps one fully constructed instance (prototype) per model
+//! type, and new items are stamped out of it by copying data and tag layout, recursively for all
+//! children. This avoids re-running expensive constructors of compound items. Only types
+//! registered via registerItem<T>(), which declare stamp constructor T(const T&, ItemStampTag),
+//! can be stamped. Other types are created by factory functions as usual.
+
+//! The same stamp constructors are used to create native deep copies of existing items (clone()),
+//! bypassing json serialization.
+
 class MVVM_MODEL_EXPORT ItemCatalogue {
 public:
     ItemCatalogue();
@@ -39,6 +50,8 @@ public:
 
     std::unique_ptr<SessionItem> create(const std::string& modelType) const;
 
+    std::unique_ptr<SessionItem> clone(const SessionItem& item, bool preserve_identifiers) const;
+
     std::vector<std::string> modelTypes() const;
 
     std::vector<std::string> labels() const;
@@ -47,14 +60,24 @@ public:
 
     void merge(const ItemCatalogue& other);
 
+    void setPrototypeMode(bool value);
+
+    bool prototypeMode() const;
+
 private:
+    void registerCloneFunction(const std::string& modelType, item_clone_func_t func,
+                               std::type_index type);
+
     struct ItemCatalogueImpl;
     std::unique_ptr<ItemCatalogueImpl> p_impl;
 };
 
 template <typename T> void ItemCatalogue::registerItem(const std::string& label)
 {
-    registerItem(T().modelType(), ItemFactoryFunction<T>(), label);
+    auto model_type = T().modelType();
+    registerItem(model_type, ItemFactoryFunction<T>(), label);
+    if constexpr (std::is_constructible_v<T, const T&, const ItemStampTag&>)
+        registerCloneFunction(model_type, ItemCloneFunction<T>(), typeid(T));
 }
 
 } // namespace ModelView
@@ -30,3 +30,9 @@ std::unique_ptr<SessionItem> ItemFactory::createItem(const model_type& modelType
 {
     return m_catalogue->create(modelType);
 }
+
+std::unique_ptr<SessionItem> ItemFactory::cloneItem(const SessionItem& item,
+                                                    bool preserve_identifiers) const
+{
+    return m_catalogue->clone(item, preserve_identifiers);
+}
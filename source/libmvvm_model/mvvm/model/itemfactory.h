@@ -30,6 +30,9 @@ public:
 
     std::unique_ptr<SessionItem> createItem(const model_type& modelType) const override;
 
+    std::unique_ptr<SessionItem> cloneItem(const SessionItem& item,
+                                           bool preserve_identifiers) const override;
+
 protected:
     std::unique_ptr<ItemCatalogue> m_catalogue;
 };
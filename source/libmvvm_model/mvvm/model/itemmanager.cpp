@@ -9,24 +9,60 @@
 
 #include "mvvm/model/itemmanager.h"
 #include "mvvm/factories/itemcataloguefactory.h"
+#include "mvvm/model/itemarena.h"
 #include "mvvm/model/itemfactory.h"
 #include "mvvm/model/itempool.h"
 #include "mvvm/model/sessionitem.h"
 
+using namespace ModelView;
+
 namespace {
 std::unique_ptr<ModelView::ItemFactory> DefaultItemFactory()
 {
     return std::make_unique<ModelView::ItemFactory>(ModelView::CreateStandardItemCatalogue());
 }
-} // namespace
 
-using namespace ModelView;
+//! Factory decorator which makes given arena current while items are created.
+
+class ArenaItemFactory : public ItemFactoryInterface {
+public:
+    ArenaItemFactory(ItemFactoryInterface* factory, ItemArena* arena)
+        : m_factory(factory), m_arena(arena)
+    {
+    }
+
+    void registerItem(const std::string& modelType, item_factory_func_t func,
+                      const std::string& label) override
+    {
+        m_factory->registerItem(modelType, func, label);
+    }
+
+    std::unique_ptr<SessionItem> createItem(const model_type& modelType) const override
+    {
+        ItemArena::Scope scope(m_arena);
+        return m_factory->createItem(modelType);
+    }
+
+    std::unique_ptr<SessionItem> cloneItem(const SessionItem& item,
+                                           bool preserve_identifiers) const override
+    {
+        ItemArena::Scope scope(m_arena);
+        return m_factory->cloneItem(item, preserve_identifiers);
+    }
+
+private:
+    ItemFactoryInterface* m_factory{nullptr};
+    ItemArena* m_arena{nullptr};
+};
+
+} // namespace
 
 ItemManager::ItemManager() : m_item_factory(DefaultItemFactory()) {}
 
 void ItemManager::setItemFactory(std::unique_ptr<ItemFactoryInterface> factory)
 {
     m_item_factory = std::move(factory);
+    setItemArena(m_item_arena);
 }
 
 void ItemManager::setItemPool(std::shared_ptr<ItemPool> pool)
@@ -34,15 +70,49 @@ void ItemManager::setItemPool(std::shared_ptr<ItemPool> pool)
     m_item_pool = std::move(pool);
 }
 
+//! Sets arena for item allocation. Nullptr arena switches allocation back to the heap. Items
+//! created before remain valid.
+
+void ItemManager::setItemArena(std::shared_ptr<ItemArena> arena)
+{
+    m_arena_factory.reset();
+    m_item_arena = std::move(arena);
+    if (m_item_arena)
+        m_arena_factory = std::make_unique<ArenaItemFactory>(m_item_factory.get(), m_item_arena.get());
+}
+
+//! Replaces the arena with a fresh one, if the arena isn't shared with other owners. Chunks of the
+//! old arena are released all at once, when the last item allocated there is destroyed. Returns
+//! true if the arena was replaced.
+
+bool ItemManager::resetItemArena()
+{
+    if (!m_item_arena || m_item_arena.use_count() > 1)
+        return false;
+
+    setItemArena(std::make_shared<ItemArena>());
+    return true;
+}
+
 ItemManager::~ItemManager() = default;
 
 std::unique_ptr<SessionItem> ItemManager::createItem(const model_type& modelType) const
 {
+    ItemArena::Scope scope(m_item_arena.get());
     return m_item_factory->createItem(modelType);
 }
 
+//! Creates item using given factory function.
+
+std::unique_ptr<SessionItem> ItemManager::createItem(const item_factory_func_t& func) const
+{
+    ItemArena::Scope scope(m_item_arena.get());
+    return func();
+}
+
 std::unique_ptr<SessionItem> ItemManager::createRootItem() const
 {
+    ItemArena::Scope scope(m_item_arena.get());
     return std::make_unique<SessionItem>();
 }
 
@@ -68,7 +138,13 @@ ItemPool* ItemManager::itemPool()
 
 void ItemManager::registerInPool(SessionItem* item)
 {
-    if (m_item_pool)
+    if (!m_item_pool)
+        return;
+
+    // identifiers generated by the item itself are registered without string formatting
+    if (auto id = item->generatedId(); !id.isNull())
+        m_item_pool->register_item(item, id);
+    else
         m_item_pool->register_item(item, item->identifier());
 }
 
@@ -78,12 +154,36 @@ void ItemManager::unregisterFromPool(SessionItem* item)
         m_item_pool->unregister_item(item);
 }
 
+//! Drops all registrations of the pool at once. This is possible only when the pool isn't shared
+//! with other models, returns false otherwise.
+
+bool ItemManager::clearItemPool()
+{
+    if (!m_item_pool || m_item_pool.use_count() > 1)
+        return false;
+
+    m_item_pool->clear();
+    return true;
+}
+
+//! Returns arena used for item allocation (nullptr if items are allocated on the heap).
+
+ItemArena* ItemManager::itemArena() const
+{
+    return m_item_arena.get();
+}
+
+//! Returns item factory. If arena is set, the factory will allocate items in it.
+
 const ItemFactoryInterface* ItemManager::factory() const
 {
-    return m_item_factory.get();
+    return m_arena_factory ? m_arena_factory.get() : m_item_factory.get();
 }
 
+//! Returns item factory (non-const version). It is the same factory as returned by the const
+//! version, so items are allocated in the arena too.
+
 ItemFactoryInterface* ItemManager::factory()
 {
-    return const_cast<ItemFactoryInterface*>(static_cast<const ItemManager*>(this)->factory());
+    return m_arena_factory ? m_arena_factory.get() : m_item_factory.get();
 }
@@ -11,6 +11,7 @@
 #define MVVM_MODEL_ITEMMANAGER_H
 
 #include "mvvm/core/types.h"
+#include "mvvm/model/function_types.h"
 #include "mvvm/model_export.h"
 #include <memory>
 
@@ -18,10 +19,14 @@ namespace ModelView {
 
 class SessionItem;
 class ItemPool;
+class ItemArena;
 class ItemFactoryInterface;
 
 //! Manages item creation/registration for SessionModel.
 
+//! When item arena is set, all items created by the manager, or by its factory, are allocated
+//! in the arena.
+
 class MVVM_MODEL_EXPORT ItemManager {
 public:
     ItemManager();
@@ -29,9 +34,13 @@ public:
 
     void setItemFactory(std::unique_ptr<ItemFactoryInterface> factory);
     void setItemPool(std::shared_ptr<ItemPool> pool);
+    void setItemArena(std::shared_ptr<ItemArena> arena);
+    bool resetItemArena();
 
     std::unique_ptr<SessionItem> createItem(const model_type& modelType = {}) const;
 
+    std::unique_ptr<SessionItem> createItem(const item_factory_func_t& func) const;
+
     std::unique_ptr<SessionItem> createRootItem() const;
 
     SessionItem* findItem(const identifier_type& id) const;
@@ -41,8 +50,11 @@ public:
     const ItemPool* itemPool() const;
     ItemPool* itemPool();
 
+    ItemArena* itemArena() const;
+
     void registerInPool(SessionItem* item);
     void unregisterFromPool(SessionItem* item);
+    bool clearItemPool();
 
     const ItemFactoryInterface* factory() const;
 
@@ -51,6 +63,8 @@ public:
 private:
     std::shared_ptr<ItemPool> m_item_pool;
     std::unique_ptr<ItemFactoryInterface> m_item_factory;
+    std::shared_ptr<ItemArena> m_item_arena;
+    std::unique_ptr<ItemFactoryInterface> m_arena_factory; //!< decorates m_item_factory
 };
 
 } // namespace ModelView
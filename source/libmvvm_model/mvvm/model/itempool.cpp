@@ -9,67 +9,269 @@
 
 #include "mvvm/model/itempool.h"
 #include "mvvm/core/uniqueidgenerator.h"
+#include <cstdint>
 #include <stdexcept>
+#include <unordered_map>
+#include <vector>
 
 using namespace ModelView;
 
+namespace {
+
+const size_t min_capacity = 16;
+
+size_t pointer_hash(const SessionItem* item)
+{
+    auto x = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(item));
+    x = (x ^ (x >> 33)) * 0xff51afd7ed558ccdULL;
+    x = (x ^ (x >> 33)) * 0xc4ceb9fe1a85ec53ULL;
+    return static_cast<size_t>(x ^ (x >> 33));
+}
+
+//! Open addressing hash table (linear probing) holding indices of pool entries.
+//! Slot value zero marks an empty slot, otherwise it is an entry index shifted by one.
+//! Table doesn't know anything about keys: hashes and key comparison are provided by the caller.
+
+class IndexTable {
+public:
+    size_t capacity() const { return m_slots.size(); }
+
+    void reset(size_t capacity) { m_slots.assign(capacity, 0); }
+
+    //! Returns position of the slot with entry matching the criteria, or position of the empty slot
+    //! where such entry should be placed.
+    template <typename Match> size_t find(size_t hash, Match match) const
+    {
+        const size_t mask = m_slots.size() - 1;
+        size_t pos = hash & mask;
+        while (m_slots[pos] != 0 && !match(m_slots[pos] - 1))
+            pos = (pos + 1) & mask;
+        return pos;
+    }
+
+    bool isEmpty(size_t pos) const { return m_slots[pos] == 0; }
+
+    uint32_t entryAt(size_t pos) const { return m_slots[pos] - 1; }
+
+    void set(size_t pos, uint32_t entry) { m_slots[pos] = entry + 1; }
+
+    //! Clears the slot at given position. Subsequent slots of the same cluster are shifted
+    //! backward, so the table never contains tombstones.
+    template <typename EntryHash> void erase(size_t pos, EntryHash entry_hash)
+    {
+        const size_t mask = m_slots.size() - 1;
+        size_t next = pos;
+        while (true) {
+            m_slots[pos] = 0;
+            while (true) {
+                next = (next + 1) & mask;
+                if (m_slots[next] == 0)
+                    return;
+                size_t home = entry_hash(m_slots[next] - 1) & mask;
+                // entry can't be moved if its home lies cyclically in (pos, next]
+                bool stays = pos <= next ? (pos < home && home <= next)
+                                         : (pos < home || home <= next);
+                if (!stays)
+                    break;
+            }
+            m_slots[pos] = m_slots[next];
+            pos = next;
+        }
+    }
+
+private:
+    std::vector<uint32_t> m_slots;
+};
+
+} // namespace
+
+struct ItemPool::ItemPoolImpl {
+    struct Entry {
+        UniqueId id;
+        SessionItem* item{nullptr};
+    };
+
+    std::vector<Entry> m_entries; //!< densely packed registrations
+    IndexTable m_id_index;        //!< identifier -> entry
+    IndexTable m_item_index;      //!< item -> entry
+    //! Original string of identifiers which are not in canonical UUID form.
+    std::unordered_map<const SessionItem*, identifier_type> m_custom_keys;
+
+    ItemPoolImpl() { rehash(min_capacity); }
+
+    size_t id_hash(uint32_t entry) const { return m_entries[entry].id.hash(); }
+    size_t item_hash(uint32_t entry) const { return pointer_hash(m_entries[entry].item); }
+
+    size_t find_id(const UniqueId& id) const
+    {
+        auto match = [this, &id](uint32_t entry) { return m_entries[entry].id == id; };
+        return m_id_index.find(id.hash(), match);
+    }
+
+    size_t find_item(const SessionItem* item) const
+    {
+        auto match = [this, item](uint32_t entry) { return m_entries[entry].item == item; };
+        return m_item_index.find(pointer_hash(item), match);
+    }
+
+    //! Rebuilds both index tables with given capacity (power of two).
+    void rehash(size_t capacity)
+    {
+        m_id_index.reset(capacity);
+        m_item_index.reset(capacity);
+        for (uint32_t entry = 0; entry < m_entries.size(); ++entry) {
+            m_id_index.set(find_id(m_entries[entry].id), entry);
+            m_item_index.set(find_item(m_entries[entry].item), entry);
+        }
+    }
+
+    //! Grows tables if necessary to keep load factor below 0.5.
+    void reserve(size_t count)
+    {
+        size_t capacity = m_id_index.capacity();
+        while (count * 2 > capacity)
+            capacity *= 2;
+        if (capacity != m_id_index.capacity())
+            rehash(capacity);
+    }
+
+    void insert(SessionItem* item, const UniqueId& id)
+    {
+        reserve(m_entries.size() + 1);
+        auto entry = static_cast<uint32_t>(m_entries.size());
+        m_entries.push_back({id, item});
+        m_id_index.set(find_id(id), entry);
+        m_item_index.set(find_item(item), entry);
+    }
+
+    //! Removes entry at given position of item index. Last entry is moved into the freed place
+    //! to keep entries densely packed.
+    void remove(size_t item_pos)
+    {
+        const uint32_t entry = m_item_index.entryAt(item_pos);
+        m_custom_keys.erase(m_entries[entry].item);
+
+        m_id_index.erase(find_id(m_entries[entry].id),
+                         [this](uint32_t x) { return id_hash(x); });
+        m_item_index.erase(item_pos, [this](uint32_t x) { return item_hash(x); });
+
+        const auto last = static_cast<uint32_t>(m_entries.size() - 1);
+        if (entry != last) {
+            m_entries[entry] = m_entries[last];
+            m_id_index.set(find_id(m_entries[entry].id), entry);
+            m_item_index.set(find_item(m_entries[entry].item), entry);
+        }
+        m_entries.pop_back();
+    }
+
+    //! Returns true if string key corresponds to the entry at given position of identifier index.
+    bool is_same_key(size_t id_pos, const identifier_type& key) const
+    {
+        auto item = m_entries[m_id_index.entryAt(id_pos)].item;
+        auto it = m_custom_keys.find(item);
+        return it == m_custom_keys.end() ? UniqueId::isCanonical(key) : it->second == key;
+    }
+};
+
+ItemPool::ItemPool() : p_impl(std::make_unique<ItemPoolImpl>()) {}
+
+ItemPool::~ItemPool() = default;
+
 size_t ItemPool::size() const
 {
-    if (m_key_to_item.size() != m_item_to_key.size())
-        throw std::runtime_error("Error in ItemPool: array size mismatch");
-    return m_key_to_item.size();
+    return p_impl->m_entries.size();
 }
 
-identifier_type ItemPool::register_item(SessionItem* item, identifier_type key)
+//! Prepares the pool to hold given number of items without rehashing.
 
+void ItemPool::reserve(size_t count)
 {
-    if (m_item_to_key.find(item) != m_item_to_key.end())
+    p_impl->m_entries.reserve(count);
+    p_impl->reserve(count);
+}
+
+identifier_type ItemPool::register_item(SessionItem* item, identifier_type key)
+{
+    if (!p_impl->m_item_index.isEmpty(p_impl->find_item(item)))
         throw std::runtime_error("ItemPool::register_item() -> Attempt to register already "
                                  "registered item.");
 
+    UniqueId id;
     if (key.empty()) {
-        key = UniqueIdGenerator::generate();
-        while (m_key_to_item.find(key) != m_key_to_item.end())
-            key = UniqueIdGenerator::generate(); // preventing improbable duplicates
+        id = UniqueIdGenerator::generateId();
+        while (!p_impl->m_id_index.isEmpty(p_impl->find_id(id)))
+            id = UniqueIdGenerator::generateId(); // preventing improbable duplicates
+        key = id.toString();
     }
     else {
-        if (m_key_to_item.find(key) != m_key_to_item.end())
+        id = UniqueId::fromString(key);
+        if (!p_impl->m_id_index.isEmpty(p_impl->find_id(id)))
             throw std::runtime_error(" ItemPool::register_item() -> Attempt to reuse existing key");
     }
 
-    m_key_to_item.insert(std::make_pair(key, item));
-    m_item_to_key.insert(std::make_pair(item, key));
+    p_impl->insert(item, id);
+    if (!UniqueId::isCanonical(key))
+        p_impl->m_custom_keys.emplace(item, key);
 
     return key;
 }
 
+//! Registers item under identifier given in the binary form. No string formatting takes place.
+
+void ItemPool::register_item(SessionItem* item, const UniqueId& id)
+{
+    if (!p_impl->m_item_index.isEmpty(p_impl->find_item(item)))
+        throw std::runtime_error("ItemPool::register_item() -> Attempt to register already "
+                                 "registered item.");
+
+    if (!p_impl->m_id_index.isEmpty(p_impl->find_id(id)))
+        throw std::runtime_error(" ItemPool::register_item() -> Attempt to reuse existing key");
+
+    p_impl->insert(item, id);
+}
+
 void ItemPool::unregister_item(SessionItem* item)
 {
-    auto it = m_item_to_key.find(item);
-    if (it == m_item_to_key.end())
+    auto pos = p_impl->find_item(item);
+    if (p_impl->m_item_index.isEmpty(pos))
         throw std::runtime_error("ItemPool::deregister_item() -> Attempt to deregister "
                                  "non existing item.");
-    auto key = it->second;
-    m_item_to_key.erase(it);
+    p_impl->remove(pos);
+}
+
+//! Drops all registrations at once.
 
-    auto it2 = m_key_to_item.find(key);
-    m_key_to_item.erase(it2);
+void ItemPool::clear()
+{
+    p_impl = std::make_unique<ItemPoolImpl>();
 }
 
 identifier_type ItemPool::key_for_item(const SessionItem* item) const
 {
-    const auto it = m_item_to_key.find(item);
-    if (it != m_item_to_key.end())
+    auto pos = p_impl->find_item(item);
+    if (p_impl->m_item_index.isEmpty(pos))
+        return {};
+
+    if (auto it = p_impl->m_custom_keys.find(item); it != p_impl->m_custom_keys.end())
         return it->second;
 
-    return {};
+    return p_impl->m_entries[p_impl->m_item_index.entryAt(pos)].id.toString();
 }
 
 SessionItem* ItemPool::item_for_key(const identifier_type& key) const
 {
-    auto it = m_key_to_item.find(key);
-    if (it != m_key_to_item.end())
-        return it->second;
+    auto pos = p_impl->find_id(UniqueId::fromString(key));
+    if (p_impl->m_id_index.isEmpty(pos) || !p_impl->is_same_key(pos, key))
+        return nullptr;
 
-    return nullptr;
+    return p_impl->m_entries[p_impl->m_id_index.entryAt(pos)].item;
+}
+
+//! Returns item registered with given binary identifier.
+
+SessionItem* ItemPool::item_for_id(const UniqueId& id) const
+{
+    auto pos = p_impl->find_id(id);
+    return p_impl->m_id_index.isEmpty(pos) ? nullptr
+                                           : p_impl->m_entries[p_impl->m_id_index.entryAt(pos)].item;
 }
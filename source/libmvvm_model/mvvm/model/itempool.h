@@ -11,8 +11,9 @@
 #define MVVM_MODEL_ITEMPOOL_H
 
 #include "mvvm/core/types.h"
+#include "mvvm/core/uniqueid.h"
 #include "mvvm/model_export.h"
-#include <map>
+#include <memory>
 
 namespace ModelView {
 
@@ -21,9 +22,14 @@ class SessionItem;
 //! Provides registration of SessionItem pointers and their unique identifiers
 //! in global memory pool.
 
+//! Internally identifiers are kept in compact binary form (UniqueId), and both directions
+//! of the lookup (identifier to item, item to identifier) are served by open addressing hash
+//! tables. String form of the identifier is only reconstructed on request.
+
 class MVVM_MODEL_EXPORT ItemPool {
 public:
-    ItemPool() = default;
+    ItemPool();
+    ~ItemPool();
     ItemPool(const ItemPool&) = delete;
     ItemPool(ItemPool&&) = delete;
     ItemPool& operator=(const ItemPool&) = delete;
@@ -31,16 +37,23 @@ public:
 
     size_t size() const;
 
+    void reserve(size_t count);
+
     identifier_type register_item(SessionItem* item, identifier_type key = {});
+    void register_item(SessionItem* item, const UniqueId& id);
     void unregister_item(SessionItem* item);
 
+    void clear();
+
     identifier_type key_for_item(const SessionItem* item) const;
 
     SessionItem* item_for_key(const identifier_type& key) const;
 
+    SessionItem* item_for_id(const UniqueId& id) const;
+
 private:
-    std::map<identifier_type, SessionItem*> m_key_to_item;
-    std::map<const SessionItem*, identifier_type> m_item_to_key;
+    struct ItemPoolImpl;
+    std::unique_ptr<ItemPoolImpl> p_impl;
 };
 
 } // namespace ModelView
@@ -0,0 +1,71 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/model/itemrange.h"
+#include "mvvm/model/sessionitemcontainer.h"
+
+using namespace ModelView;
+
+ItemRange::const_iterator::const_iterator(container_iterator container,
+                                          container_iterator container_end)
+    : m_container(container), m_container_end(container_end)
+{
+    skip_empty();
+}
+
+//! Positions iterator at the first item of the current container, or of the next non-empty one.
+
+void ItemRange::const_iterator::skip_empty()
+{
+    for (; m_container != m_container_end; ++m_container) {
+        if (!(*m_container)->empty()) {
+            m_item = (*m_container)->begin();
+            m_item_end = (*m_container)->end();
+            return;
+        }
+    }
+}
+
+ItemRange::ItemRange(container_iterator first, container_iterator last)
+    : m_first(first), m_last(last)
+{
+}
+
+ItemRange::const_iterator ItemRange::begin() const
+{
+    return {m_first, m_last};
+}
+
+ItemRange::const_iterator ItemRange::end() const
+{
+    return {m_last, m_last};
+}
+
+bool ItemRange::empty() const
+{
+    return begin() == end();
+}
+
+//! Returns number of items in the range. Doesn't visit items.
+
+int ItemRange::size() const
+{
+    int result{0};
+    for (auto it = m_first; it != m_last; ++it)
+        result += (*it)->itemCount();
+    return result;
+}
+
+std::vector<SessionItem*> ItemRange::toVector() const
+{
+    std::vector<SessionItem*> result;
+    result.reserve(static_cast<size_t>(size()));
+    result.insert(result.end(), begin(), end());
+    return result;
+}
@@ -0,0 +1,98 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_MODEL_ITEMRANGE_H
+#define MVVM_MODEL_ITEMRANGE_H
+
+#include "mvvm/model_export.h"
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+namespace ModelView {
+
+class SessionItem;
+class SessionItemContainer;
+
+//! Lightweight view on children of SessionItem stored in one or several containers.
+
+//! Allows iteration over children without copying them into a new vector. The range is invalidated
+//! by the insertion or removal of children.
+
+class MVVM_MODEL_EXPORT ItemRange {
+public:
+    using container_iterator = std::vector<SessionItemContainer*>::const_iterator;
+    using item_iterator = std::vector<SessionItem*>::const_iterator;
+
+    //! Forward iterator over items of consecutive containers.
+    class MVVM_MODEL_EXPORT const_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = SessionItem*;
+        using difference_type = std::ptrdiff_t;
+        using pointer = SessionItem* const*;
+        using reference = SessionItem* const&;
+
+        const_iterator() = default;
+        const_iterator(container_iterator container, container_iterator container_end);
+
+        reference operator*() const { return *m_item; }
+
+        const_iterator& operator++()
+        {
+            if (++m_item == m_item_end) {
+                ++m_container;
+                skip_empty();
+            }
+            return *this;
+        }
+
+        const_iterator operator++(int)
+        {
+            auto result = *this;
+            ++(*this);
+            return result;
+        }
+
+        bool operator==(const const_iterator& other) const
+        {
+            return m_container == other.m_container
+                   && (m_container == m_container_end || m_item == other.m_item);
+        }
+
+        bool operator!=(const const_iterator& other) const { return !(*this == other); }
+
+    private:
+        void skip_empty();
+
+        container_iterator m_container;
+        container_iterator m_container_end;
+        item_iterator m_item;
+        item_iterator m_item_end;
+    };
+
+    ItemRange() = default;
+    ItemRange(container_iterator first, container_iterator last);
+
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    bool empty() const;
+    int size() const;
+
+    std::vector<SessionItem*> toVector() const;
+
+private:
+    container_iterator m_first;
+    container_iterator m_last;
+};
+
+} // namespace ModelView
+
+#endif // MVVM_MODEL_ITEMRANGE_H
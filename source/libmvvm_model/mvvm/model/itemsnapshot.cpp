@@ -0,0 +1,138 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/model/itemsnapshot.h"
+#include "mvvm/model/sessionitem.h"
+#include "mvvm/model/sessionitemcontainer.h"
+#include "mvvm/model/sessionitemdata.h"
+#include "mvvm/model/sessionitemtags.h"
+
+using namespace ModelView;
+
+//! Copies content of the item. Snapshots of children are provided by the given function, when
+//! the function is absent, children are copied recursively.
+
+ItemSnapshot::ItemSnapshot(const SessionItem* item, const child_func_t& child_func)
+    : m_modelType(item->modelType())
+    , m_identifier(item->identifier())
+    , m_displayName(item->displayName())
+    , m_data(item->itemData()->begin(), item->itemData()->end())
+    , m_defaultTag(item->itemTags()->defaultTag())
+{
+    for (auto container : *item->itemTags()) {
+        Tag tag{container->name(), {}};
+        tag.m_items.reserve(static_cast<size_t>(container->itemCount()));
+        for (auto child : *container)
+            tag.m_items.push_back(child_func ? child_func(child) : create(child));
+        m_tags.push_back(std::move(tag));
+    }
+}
+
+//! Creates snapshot of the item together with all its children.
+
+std::shared_ptr<const ItemSnapshot> ItemSnapshot::create(const SessionItem* item)
+{
+    return std::make_shared<const ItemSnapshot>(item);
+}
+
+const model_type& ItemSnapshot::modelType() const
+{
+    return m_modelType;
+}
+
+const std::string& ItemSnapshot::identifier() const
+{
+    return m_identifier;
+}
+
+const std::string& ItemSnapshot::displayName() const
+{
+    return m_displayName;
+}
+
+bool ItemSnapshot::hasData(int role) const
+{
+    for (const auto& value : m_data)
+        if (value.m_role == role)
+            return true;
+    return false;
+}
+
+Variant ItemSnapshot::data(int role) const
+{
+    for (const auto& value : m_data)
+        if (value.m_role == role)
+            return value.m_data;
+    return Variant();
+}
+
+//! Returns names of all registered tags.
+
+std::vector<std::string> ItemSnapshot::tags() const
+{
+    std::vector<std::string> result;
+    for (const auto& tag : m_tags)
+        result.push_back(tag.m_name);
+    return result;
+}
+
+int ItemSnapshot::childrenCount() const
+{
+    size_t result{0};
+    for (const auto& tag : m_tags)
+        result += tag.m_items.size();
+    return static_cast<int>(result);
+}
+
+//! Returns snapshots of all children in the order of tags.
+
+std::vector<const ItemSnapshot*> ItemSnapshot::children() const
+{
+    std::vector<const ItemSnapshot*> result;
+    for (const auto& tag : m_tags)
+        for (const auto& item : tag.m_items)
+            result.push_back(item.get());
+    return result;
+}
+
+int ItemSnapshot::itemCount(const std::string& tag) const
+{
+    auto found = find_tag(tag);
+    return found ? static_cast<int>(found->m_items.size()) : 0;
+}
+
+//! Returns child snapshot at given row of given tag, or nullptr if there is no such child.
+
+const ItemSnapshot* ItemSnapshot::getItem(const std::string& tag, int row) const
+{
+    auto found = find_tag(tag);
+    if (!found || row < 0 || row >= static_cast<int>(found->m_items.size()))
+        return nullptr;
+    return found->m_items[static_cast<size_t>(row)].get();
+}
+
+std::vector<const ItemSnapshot*> ItemSnapshot::getItems(const std::string& tag) const
+{
+    std::vector<const ItemSnapshot*> result;
+    if (auto found = find_tag(tag); found)
+        for (const auto& item : found->m_items)
+            result.push_back(item.get());
+    return result;
+}
+
+//! Returns tag with given name, empty name stands for the default tag.
+
+const ItemSnapshot::Tag* ItemSnapshot::find_tag(const std::string& tag) const
+{
+    const auto& name = tag.empty() ? m_defaultTag : tag;
+    for (const auto& x : m_tags)
+        if (x.m_name == name)
+            return &x;
+    return nullptr;
+}
@@ -0,0 +1,100 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_MODEL_ITEMSNAPSHOT_H
+#define MVVM_MODEL_ITEMSNAPSHOT_H
+
+#include "mvvm/model/datarole.h"
+#include "mvvm/model/mvvm_types.h"
+#include "mvvm/model_export.h"
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ModelView {
+
+class SessionItem;
+
+//! Immutable copy of SessionItem and its children, taken at some moment of time.
+
+//! Snapshot doesn't refer to the original items, so it can be read concurrently from any thread
+//! while the model keeps changing. Children are held via shared pointers, which allows several
+//! snapshots to share unchanged branches (see ItemSnapshotCache).
+
+class MVVM_MODEL_EXPORT ItemSnapshot {
+public:
+    using child_func_t = std::function<std::shared_ptr<const ItemSnapshot>(const SessionItem*)>;
+
+    explicit ItemSnapshot(const SessionItem* item, const child_func_t& child_func = {});
+    ItemSnapshot(const ItemSnapshot&) = delete;
+    ItemSnapshot& operator=(const ItemSnapshot&) = delete;
+
+    static std::shared_ptr<const ItemSnapshot> create(const SessionItem* item);
+
+    const model_type& modelType() const;
+
+    const std::string& identifier() const;
+
+    const std::string& displayName() const;
+
+    bool hasData(int role = ItemDataRole::DATA) const;
+
+    Variant data(int role = ItemDataRole::DATA) const;
+
+    template <typename T> T data(int role = ItemDataRole::DATA) const;
+
+    std::vector<std::string> tags() const;
+
+    int childrenCount() const;
+
+    std::vector<const ItemSnapshot*> children() const;
+
+    int itemCount(const std::string& tag) const;
+
+    const ItemSnapshot* getItem(const std::string& tag, int row = 0) const;
+
+    std::vector<const ItemSnapshot*> getItems(const std::string& tag) const;
+
+    template <typename T> T property(const std::string& tag) const;
+
+private:
+    struct Tag {
+        std::string m_name;
+        std::vector<std::shared_ptr<const ItemSnapshot>> m_items;
+    };
+    const Tag* find_tag(const std::string& tag) const;
+
+    model_type m_modelType;
+    std::string m_identifier;
+    std::string m_displayName;
+    std::vector<DataRole> m_data;
+    std::vector<Tag> m_tags;
+    std::string m_defaultTag;
+};
+
+//! Returns data of given type T for given role.
+
+template <typename T> inline T ItemSnapshot::data(int role) const
+{
+    return data(role).value<T>();
+}
+
+//! Returns data stored in property item.
+//! Property is single item registered under certain tag via CompoundItem::addProperty method.
+
+template <typename T> inline T ItemSnapshot::property(const std::string& tag) const
+{
+    auto item = getItem(tag);
+    return item ? item->data<T>() : T();
+}
+
+} // namespace ModelView
+
+#endif // MVVM_MODEL_ITEMSNAPSHOT_H
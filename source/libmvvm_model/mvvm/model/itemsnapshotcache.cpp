@@ -0,0 +1,93 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/model/itemsnapshotcache.h"
+#include "mvvm/model/itemsnapshot.h"
+#include "mvvm/model/sessionitem.h"
+#include "mvvm/model/sessionmodel.h"
+#include <stdexcept>
+#include <unordered_map>
+
+using namespace ModelView;
+
+struct ItemSnapshotCache::ItemSnapshotCacheImpl {
+    //! Cached snapshots. If an item has a snapshot, all its descendants have it too.
+    std::unordered_map<const SessionItem*, std::shared_ptr<const ItemSnapshot>> m_snapshots;
+
+    std::shared_ptr<const ItemSnapshot> snapshot(const SessionItem* item)
+    {
+        if (auto it = m_snapshots.find(item); it != m_snapshots.end())
+            return it->second;
+
+        auto result = std::make_shared<const ItemSnapshot>(
+            item, [this](const SessionItem* child) { return snapshot(child); });
+        m_snapshots.emplace(item, result);
+        return result;
+    }
+
+    //! Drops snapshots of the item and of all its ancestors.
+    void invalidate(const SessionItem* item)
+    {
+        // ancestors of the item without a snapshot can't have a snapshot either
+        for (auto current = item; current; current = current->parent())
+            if (m_snapshots.erase(current) == 0)
+                return;
+    }
+
+    //! Drops snapshots of the item, which is about to be removed, and of all its descendants.
+    void forget(const SessionItem* item)
+    {
+        m_snapshots.erase(item);
+        for (auto child : item->children())
+            forget(child);
+    }
+};
+
+ItemSnapshotCache::ItemSnapshotCache(SessionModel* model)
+    : ModelListener(model), p_impl(std::make_unique<ItemSnapshotCacheImpl>())
+{
+    setOnDataChange([this](SessionItem* item, int) { p_impl->invalidate(item); });
+
+    setOnItemInserted([this](SessionItem* parent, const TagRow&) { p_impl->invalidate(parent); });
+
+    auto on_about_to_remove = [this](SessionItem* parent, const TagRow& tagrow) {
+        p_impl->forget(parent->getItem(tagrow.tag, tagrow.row));
+        p_impl->invalidate(parent);
+    };
+    setOnAboutToRemoveItem(on_about_to_remove);
+
+    setOnModelAboutToBeReset([this](SessionModel*) { p_impl->m_snapshots.clear(); });
+    setOnModelDestroyed([this](SessionModel*) { p_impl->m_snapshots.clear(); });
+}
+
+ItemSnapshotCache::~ItemSnapshotCache() = default;
+
+//! Returns snapshot of the given item, or of the whole model, if item is not provided.
+
+std::shared_ptr<const ItemSnapshot> ItemSnapshotCache::snapshot(const SessionItem* item)
+{
+    if (!model())
+        throw std::runtime_error("ItemSnapshotCache::snapshot() -> Model was destroyed");
+
+    if (!item)
+        item = model()->rootItem();
+
+    if (item->model() != model())
+        throw std::runtime_error(
+            "ItemSnapshotCache::snapshot() -> Item doesn't belong to given model");
+
+    return p_impl->snapshot(item);
+}
+
+//! Returns number of items having cached snapshot.
+
+size_t ItemSnapshotCache::size() const
+{
+    return p_impl->m_snapshots.size();
+}
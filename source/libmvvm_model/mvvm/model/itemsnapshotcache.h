@@ -0,0 +1,45 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_MODEL_ITEMSNAPSHOTCACHE_H
+#define MVVM_MODEL_ITEMSNAPSHOTCACHE_H
+
+#include "mvvm/signals/modellistener.h"
+#include <memory>
+
+namespace ModelView {
+
+class SessionItem;
+class SessionModel;
+class ItemSnapshot;
+
+//! Provides immutable snapshots of the model content, which can be handed over to worker threads.
+
+//! Snapshots of items are cached and invalidated when items change. Consecutive snapshots of the
+//! model share all branches which weren't changed in between, so taking a snapshot after a small
+//! edit costs only the depth of the edited item. Snapshots should be requested from the thread
+//! owning the model, snapshots themselves can be read from any thread.
+
+class MVVM_MODEL_EXPORT ItemSnapshotCache : public ModelListener<SessionModel> {
+public:
+    explicit ItemSnapshotCache(SessionModel* model);
+    ~ItemSnapshotCache() override;
+
+    std::shared_ptr<const ItemSnapshot> snapshot(const SessionItem* item = nullptr);
+
+    size_t size() const;
+
+private:
+    struct ItemSnapshotCacheImpl;
+    std::unique_ptr<ItemSnapshotCacheImpl> p_impl;
+};
+
+} // namespace ModelView
+
+#endif // MVVM_MODEL_ITEMSNAPSHOTCACHE_H
@@ -0,0 +1,192 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/model/itemtypeindex.h"
+#include "mvvm/model/itemutils.h"
+#include "mvvm/model/sessionitem.h"
+#include <algorithm>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+
+using namespace ModelView;
+
+struct ItemTypeIndex::ItemTypeIndexImpl {
+    //! Items of the same model type.
+    struct Group {
+        std::vector<SessionItem*> m_items;
+        std::type_index m_type{typeid(void)}; //!< C++ type of the first item in the group
+        bool m_uniform{true};                 //!< all items of the group have the same C++ type
+    };
+
+    //! Group and position in the group for every indexed item, and its rank in the tree order.
+    struct Location {
+        Group* m_group{nullptr};
+        size_t m_position{0};
+        size_t m_rank{0};
+    };
+
+    std::unordered_map<Symbol, Group> m_groups;
+    std::unordered_map<const SessionItem*, Location> m_locations;
+    bool m_ranks_valid{false}; //!< ranks are up to date with the tree structure
+
+    //! Appends items of the group matching the criteria. The first item of the group represents
+    //! the whole group, unless items of different C++ types share the same model type.
+    void collect(const Group& group, const match_func_t& match,
+                 std::vector<SessionItem*>& result) const
+    {
+        if (group.m_items.empty())
+            return;
+
+        if (group.m_uniform) {
+            if (match(group.m_items.front()))
+                result.insert(result.end(), group.m_items.begin(), group.m_items.end());
+            return;
+        }
+
+        for (auto item : group.m_items)
+            if (match(item))
+                result.push_back(item);
+    }
+
+    //! Assigns ranks in the order of tree traversal to all items of the tree.
+    void update_ranks(const SessionItem* item)
+    {
+        auto root = item;
+        while (root->parent())
+            root = root->parent();
+
+        size_t rank{0};
+        Utils::iterate_if(root, [this, &rank](const SessionItem* current) {
+            if (auto it = m_locations.find(current); it != m_locations.end())
+                it->second.m_rank = rank;
+            ++rank;
+            return true;
+        });
+        m_ranks_valid = true;
+    }
+
+    //! Sorts items in the order of tree traversal. Ranks are computed once after the structural
+    //! change of the tree, and are reused by following queries.
+    void sort(std::vector<SessionItem*>& items)
+    {
+        if (items.size() < 2)
+            return;
+
+        if (!m_ranks_valid)
+            update_ranks(items.front());
+
+        std::vector<std::pair<size_t, SessionItem*>> ranked;
+        ranked.reserve(items.size());
+        for (auto item : items)
+            ranked.emplace_back(m_locations.at(item).m_rank, item);
+        std::sort(ranked.begin(), ranked.end());
+        for (size_t index = 0; index < items.size(); ++index)
+            items[index] = ranked[index].second;
+    }
+};
+
+ItemTypeIndex::ItemTypeIndex() : p_impl(std::make_unique<ItemTypeIndexImpl>()) {}
+
+ItemTypeIndex::~ItemTypeIndex() = default;
+
+//! Adds item to the index. Item has to be fully constructed.
+
+void ItemTypeIndex::addItem(SessionItem* item)
+{
+    if (p_impl->m_locations.count(item))
+        return;
+
+    auto& group = p_impl->m_groups[item->modelTypeSymbol()];
+    std::type_index type = typeid(*item);
+    if (group.m_items.empty())
+        group.m_type = type;
+    else if (group.m_type != type)
+        group.m_uniform = false;
+
+    p_impl->m_locations.emplace(item, ItemTypeIndexImpl::Location{&group, group.m_items.size()});
+    group.m_items.push_back(item);
+    p_impl->m_ranks_valid = false;
+}
+
+//! Removes item from the index. Can be called from item's destructor. Returns false if the item
+//! wasn't indexed.
+
+bool ItemTypeIndex::removeItem(const SessionItem* item)
+{
+    auto it = p_impl->m_locations.find(item);
+    if (it == p_impl->m_locations.end())
+        return false;
+
+    auto group = it->second.m_group;
+    auto position = it->second.m_position;
+    p_impl->m_locations.erase(it);
+    p_impl->m_ranks_valid = false;
+
+    // last item of the group takes the place of removed one
+    auto last = group->m_items.back();
+    group->m_items.pop_back();
+    if (last != item) {
+        group->m_items[position] = last;
+        p_impl->m_locations[last].m_position = position;
+    }
+
+    if (group->m_items.empty())
+        group->m_uniform = true;
+    return true;
+}
+
+//! Removes all items from the index at once.
+
+void ItemTypeIndex::clear()
+{
+    p_impl = std::make_unique<ItemTypeIndexImpl>();
+}
+
+//! Returns number of indexed items.
+
+size_t ItemTypeIndex::size() const
+{
+    return p_impl->m_locations.size();
+}
+
+//! Returns items of given model type in the order of tree traversal.
+
+std::vector<SessionItem*> ItemTypeIndex::findItems(const model_type& modelType) const
+{
+    std::vector<SessionItem*> result;
+    auto it = p_impl->m_groups.find(Symbol::find(modelType));
+    if (it != p_impl->m_groups.end())
+        result = it->second.m_items;
+    p_impl->sort(result);
+    return result;
+}
+
+//! Returns items satisfying given criteria in the order of tree traversal. Criteria should depend
+//! only on the C++ type of the item (i.e. dynamic_cast to a certain type).
+
+std::vector<SessionItem*> ItemTypeIndex::findItems(const match_func_t& match) const
+{
+    std::vector<SessionItem*> result;
+    for (const auto& it : p_impl->m_groups)
+        p_impl->collect(it.second, match, result);
+
+    // when all items are requested, traversal of the tree is cheaper than sorting
+    if (result.size() == size() && !result.empty()) {
+        auto root = result.front();
+        while (root->parent())
+            root = root->parent();
+        result.clear();
+        Utils::iterate(root, [&result](SessionItem* item) { result.push_back(item); });
+        return result;
+    }
+
+    p_impl->sort(result);
+    return result;
+}
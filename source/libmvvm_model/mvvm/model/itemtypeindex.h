@@ -0,0 +1,59 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_MODEL_ITEMTYPEINDEX_H
+#define MVVM_MODEL_ITEMTYPEINDEX_H
+
+#include "mvvm/core/types.h"
+#include "mvvm/model_export.h"
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace ModelView {
+
+class SessionItem;
+
+//! Index of items belonging to the model, grouped by their model type.
+
+//! Items are added and removed incrementally, when they enter or leave the model. Queries touch
+//! only groups of items of matching types, so their cost is proportional to the size of the result
+//! and the number of distinct model types, rather than the size of the model. Results are ordered
+//! using ranks of items in the tree, which are recalculated by the first query after the structural
+//! change of the model.
+
+class MVVM_MODEL_EXPORT ItemTypeIndex {
+public:
+    using match_func_t = std::function<bool(const SessionItem*)>;
+
+    ItemTypeIndex();
+    ~ItemTypeIndex();
+    ItemTypeIndex(const ItemTypeIndex&) = delete;
+    ItemTypeIndex& operator=(const ItemTypeIndex&) = delete;
+
+    void addItem(SessionItem* item);
+
+    bool removeItem(const SessionItem* item);
+
+    void clear();
+
+    size_t size() const;
+
+    std::vector<SessionItem*> findItems(const model_type& modelType) const;
+
+    std::vector<SessionItem*> findItems(const match_func_t& match) const;
+
+private:
+    struct ItemTypeIndexImpl;
+    std::unique_ptr<ItemTypeIndexImpl> p_impl;
+};
+
+} // namespace ModelView
+
+#endif // MVVM_MODEL_ITEMTYPEINDEX_H
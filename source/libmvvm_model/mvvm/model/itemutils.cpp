@@ -23,7 +23,7 @@ void Utils::iterate(SessionItem* item, const std::function<void(SessionItem*)>&
     else
         return;
 
-    for (auto child : item->children())
+    for (auto child : item->childrenRange())
         iterate(child, fun);
 }
 
@@ -37,7 +37,7 @@ void Utils::iterate_if(const SessionItem* item, const std::function<bool(const S
     if (!item || !proceed_with_children)
         return;
 
-    for (auto child : item->children())
+    for (auto child : item->childrenRange())
         iterate_if(child, fun);
 }
 
@@ -51,7 +51,7 @@ int Utils::CopyNumber(const SessionItem* item)
     int count(0);
     auto model_type = item->modelType();
     if (auto parent = item->parent()) {
-        for (auto child : parent->children()) {
+        for (auto child : parent->childrenRange()) {
             if (child == item)
                 result = count;
             if (child->modelType() == model_type)
@@ -67,15 +67,26 @@ SessionItem* Utils::ChildAt(const SessionItem* parent, int index)
     if (!parent)
         return nullptr;
 
-    auto container = parent->children();
-    return index >= 0 && static_cast<size_t>(index) < container.size()
-               ? container[static_cast<size_t>(index)]
-               : nullptr;
+    if (index < 0)
+        return nullptr;
+
+    for (const auto container : *parent->itemTags()) {
+        if (index < container->itemCount())
+            return container->itemAt(index);
+        index -= container->itemCount();
+    }
+    return nullptr;
 }
 
 int Utils::IndexOfChild(const SessionItem* parent, const SessionItem* child)
 {
-    return Utils::IndexOfItem(parent->children(), child);
+    int offset{0};
+    for (const auto container : *parent->itemTags()) {
+        if (int row = container->indexOfItem(child); row != -1)
+            return offset + row;
+        offset += container->itemCount();
+    }
+    return -1;
 }
 
 bool Utils::HasTag(const SessionItem& item, const std::string& tag)
@@ -108,18 +119,26 @@ std::vector<std::string> Utils::RegisteredUniversalTags(const SessionItem& item)
 std::vector<SessionItem*> Utils::TopLevelItems(const SessionItem& item)
 {
     std::vector<SessionItem*> result;
-    for (auto child : item.children())
-        if (child->isVisible() && !IsSinglePropertyTag(item, item.tagRowOfItem(child).tag))
-            result.push_back(child);
+    for (const auto container : *item.itemTags()) {
+        if (container->tagInfo().isSinglePropertyTag())
+            continue;
+        for (auto child : *container)
+            if (child->isVisible())
+                result.push_back(child);
+    }
     return result;
 }
 
 std::vector<SessionItem*> Utils::SinglePropertyItems(const SessionItem& item)
 {
     std::vector<SessionItem*> result;
-    for (auto child : item.children())
-        if (child->isVisible() && IsSinglePropertyTag(item, item.tagRowOfItem(child).tag))
-            result.push_back(child);
+    for (const auto container : *item.itemTags()) {
+        if (!container->tagInfo().isSinglePropertyTag())
+            continue;
+        for (auto child : *container)
+            if (child->isVisible())
+                result.push_back(child);
+    }
     return result;
 }
 
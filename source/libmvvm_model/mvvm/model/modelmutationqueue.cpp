@@ -0,0 +1,255 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/model/modelmutationqueue.h"
+#include "mvvm/commands/commandutils.h"
+#include "mvvm/model/modelutils.h"
+#include "mvvm/model/path.h"
+#include "mvvm/model/sessionitem.h"
+#include "mvvm/model/sessionmodel.h"
+#include "mvvm/model/tagrow.h"
+#include <deque>
+#include <iterator>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+
+using namespace ModelView;
+
+namespace {
+
+enum class MutationType { SET_DATA, INSERT, REMOVE };
+
+//! Item addressed either by identifier or by path.
+struct Target {
+    identifier_type m_identifier;
+    Path m_path;
+    bool m_by_path{false};
+
+    //! Returns string uniquely representing the address.
+    std::string key() const { return m_by_path ? "p" + m_path.str() : "i" + m_identifier; }
+};
+
+Target target_from(const identifier_type& identifier)
+{
+    return {identifier, {}, false};
+}
+
+Target target_from(const Path& path)
+{
+    return {{}, path, true};
+}
+
+struct Mutation {
+    MutationType m_type;
+    Target m_target;
+    Variant m_value;
+    int m_role{-1};
+    model_type m_modelType;
+    TagRow m_tagrow;
+};
+
+} // namespace
+
+struct ModelMutationQueue::ModelMutationQueueImpl {
+    SessionModel* m_model{nullptr};
+    mutable std::mutex m_mutex;
+    std::deque<Mutation> m_queue;
+    size_t m_first_sequence{0}; //!< sequence number of the first element in the queue
+    //! Sequence numbers of data writes posted since the last insert or removal, by target and role.
+    std::unordered_map<std::string, size_t> m_data_writes;
+    callback_t m_on_posted;
+    error_callback_t m_on_error;
+
+    explicit ModelMutationQueueImpl(SessionModel* model) : m_model(model) {}
+
+    void post(Mutation mutation)
+    {
+        callback_t on_posted;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (mutation.m_type == MutationType::SET_DATA) {
+                if (coalesce(mutation))
+                    return;
+            }
+            else {
+                // writes can't be moved across structural changes
+                m_data_writes.clear();
+            }
+            if (m_queue.empty())
+                on_posted = m_on_posted;
+            m_queue.push_back(std::move(mutation));
+        }
+        if (on_posted)
+            on_posted();
+    }
+
+    //! Replaces the value of not yet applied write to the same target and role. Returns true
+    //! on success, otherwise registers the write as a candidate for subsequent coalescing.
+    bool coalesce(const Mutation& mutation)
+    {
+        auto key = mutation.m_target.key() + '\n' + std::to_string(mutation.m_role);
+        auto it = m_data_writes.find(key);
+        if (it != m_data_writes.end() && it->second >= m_first_sequence) {
+            m_queue[it->second - m_first_sequence].m_value = mutation.m_value;
+            return true;
+        }
+        m_data_writes[key] = m_first_sequence + m_queue.size();
+        return false;
+    }
+
+    std::deque<Mutation> take(int max_count)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        std::deque<Mutation> result;
+        if (max_count < 0 || static_cast<size_t>(max_count) >= m_queue.size()) {
+            result.swap(m_queue);
+            m_data_writes.clear();
+        }
+        else {
+            auto end = std::next(m_queue.begin(), max_count);
+            std::move(m_queue.begin(), end, std::back_inserter(result));
+            m_queue.erase(m_queue.begin(), end);
+        }
+        m_first_sequence += result.size();
+        return result;
+    }
+
+    SessionItem* find_item(const Target& target) const
+    {
+        return target.m_by_path ? Utils::ItemFromPath(*m_model, target.m_path)
+                                : m_model->findItem(target.m_identifier);
+    }
+
+    //! Applies the mutation to the model, returns false if the target wasn't found.
+    bool apply(const Mutation& mutation)
+    {
+        auto item = find_item(mutation.m_target);
+        if (!item)
+            return false;
+
+        switch (mutation.m_type) {
+        case MutationType::SET_DATA:
+            m_model->setData(item, mutation.m_value, mutation.m_role);
+            return true;
+        case MutationType::INSERT:
+            return m_model->insertNewItem(mutation.m_modelType, item, mutation.m_tagrow) != nullptr;
+        case MutationType::REMOVE:
+            if (!item->parent())
+                return false;
+            m_model->removeItem(item->parent(), item->tagRow());
+            return true;
+        }
+        return false;
+    }
+};
+
+ModelMutationQueue::ModelMutationQueue(SessionModel* model)
+    : p_impl(std::make_unique<ModelMutationQueueImpl>(model))
+{
+}
+
+ModelMutationQueue::~ModelMutationQueue() = default;
+
+//! Posts new value for given role of the item with given identifier.
+
+void ModelMutationQueue::postData(const identifier_type& identifier, const Variant& value,
+                                  int role)
+{
+    p_impl->post({MutationType::SET_DATA, target_from(identifier), value, role, {}, {}});
+}
+
+//! Posts new value for given role of the item with given path.
+
+void ModelMutationQueue::postData(const Path& path, const Variant& value, int role)
+{
+    p_impl->post({MutationType::SET_DATA, target_from(path), value, role, {}, {}});
+}
+
+//! Posts insertion of the new item of given type into the parent with given identifier.
+
+void ModelMutationQueue::postInsert(const identifier_type& parent_identifier,
+                                    const model_type& modelType, const TagRow& tagrow)
+{
+    p_impl->post({MutationType::INSERT, target_from(parent_identifier), {}, -1, modelType, tagrow});
+}
+
+//! Posts insertion of the new item of given type into the parent with given path.
+
+void ModelMutationQueue::postInsert(const Path& parent_path, const model_type& modelType,
+                                    const TagRow& tagrow)
+{
+    p_impl->post({MutationType::INSERT, target_from(parent_path), {}, -1, modelType, tagrow});
+}
+
+//! Posts removal of the item with given identifier.
+
+void ModelMutationQueue::postRemove(const identifier_type& identifier)
+{
+    p_impl->post({MutationType::REMOVE, target_from(identifier), {}, -1, {}, {}});
+}
+
+//! Posts removal of the item with given path.
+
+void ModelMutationQueue::postRemove(const Path& path)
+{
+    p_impl->post({MutationType::REMOVE, target_from(path), {}, -1, {}, {}});
+}
+
+//! Returns number of changes waiting to be applied.
+
+size_t ModelMutationQueue::pendingCount() const
+{
+    std::lock_guard<std::mutex> lock(p_impl->m_mutex);
+    return p_impl->m_queue.size();
+}
+
+//! Sets callback to report that the queue, which was empty, got new changes. Callback is called
+//! from the posting thread, it is intended to schedule process() in the thread owning the model.
+
+void ModelMutationQueue::setOnPosted(callback_t callback)
+{
+    std::lock_guard<std::mutex> lock(p_impl->m_mutex);
+    p_impl->m_on_posted = std::move(callback);
+}
+
+//! Sets callback to report changes which have failed to apply. Callback is called from process()
+//! with the message of the exception thrown by the model.
+
+void ModelMutationQueue::setOnError(error_callback_t callback)
+{
+    p_impl->m_on_error = std::move(callback);
+}
+
+//! Applies at most 'max_count' changes (all pending changes, if negative) to the model in a single
+//! notification batch. Changes addressed to items which don't exist anymore are dropped. Changes
+//! rejected by the model with an exception are dropped too and reported via error callback, the
+//! rest of the portion is still applied. Returns number of applied changes.
+
+int ModelMutationQueue::process(int max_count)
+{
+    auto mutations = p_impl->take(max_count);
+    if (mutations.empty())
+        return 0;
+
+    int result{0};
+    BatchGuard batch(p_impl->m_model);
+    for (const auto& mutation : mutations) {
+        try {
+            if (p_impl->apply(mutation))
+                ++result;
+        }
+        catch (const std::exception& ex) {
+            if (p_impl->m_on_error)
+                p_impl->m_on_error(ex.what());
+        }
+    }
+    batch.commit();
+    return result;
+}
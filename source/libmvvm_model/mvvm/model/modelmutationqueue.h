@@ -0,0 +1,73 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_MODEL_MODELMUTATIONQUEUE_H
+#define MVVM_MODEL_MODELMUTATIONQUEUE_H
+
+#include "mvvm/core/variant.h"
+#include "mvvm/model/mvvm_types.h"
+#include "mvvm/model_export.h"
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace ModelView {
+
+class SessionModel;
+class Path;
+class TagRow;
+
+//! Thread-safe queue of changes to be applied to SessionModel.
+
+//! Worker threads post changes addressed by item identifier or by item path. The thread owning
+//! the model applies them in portions by calling process(). Repeated writes to the same item and
+//! role, which weren't applied yet, are coalesced into a single write. Each portion is applied
+//! inside a single notification batch of the model.
+
+class MVVM_MODEL_EXPORT ModelMutationQueue {
+public:
+    using callback_t = std::function<void()>;
+    using error_callback_t = std::function<void(const std::string&)>;
+
+    explicit ModelMutationQueue(SessionModel* model);
+    ~ModelMutationQueue();
+    ModelMutationQueue(const ModelMutationQueue&) = delete;
+    ModelMutationQueue& operator=(const ModelMutationQueue&) = delete;
+
+    // methods which can be called from any thread
+
+    void postData(const identifier_type& identifier, const Variant& value,
+                  int role = ItemDataRole::DATA);
+    void postData(const Path& path, const Variant& value, int role = ItemDataRole::DATA);
+
+    void postInsert(const identifier_type& parent_identifier, const model_type& modelType,
+                    const TagRow& tagrow);
+    void postInsert(const Path& parent_path, const model_type& modelType, const TagRow& tagrow);
+
+    void postRemove(const identifier_type& identifier);
+    void postRemove(const Path& path);
+
+    size_t pendingCount() const;
+
+    void setOnPosted(callback_t callback);
+
+    // methods to be called from the thread owning the model
+
+    void setOnError(error_callback_t callback);
+
+    int process(int max_count = -1);
+
+private:
+    struct ModelMutationQueueImpl;
+    std::unique_ptr<ModelMutationQueueImpl> p_impl;
+};
+
+} // namespace ModelView
+
+#endif // MVVM_MODEL_MODELMUTATIONQUEUE_H
@@ -8,9 +8,11 @@
 // ************************************************************************** //
 
 #include "mvvm/model/modelutils.h"
+#include "mvvm/interfaces/itemfactoryinterface.h"
 #include "mvvm/interfaces/undostackinterface.h"
 #include "mvvm/model/path.h"
 #include <QJsonObject>
+#include <stdexcept>
 
 using namespace ModelView;
 
@@ -46,6 +48,30 @@ void Utils::PopulateEmptyModel(const JsonModelConverterInterface* converter,
     converter->from_json(object, target);
 }
 
+bool Utils::PopulateEmptyModelNative(const SessionModel& source, SessionModel& target,
+                                     bool preserve_identifiers)
+{
+    if (source.modelType() != target.modelType())
+        throw std::runtime_error("Utils::PopulateEmptyModelNative() -> Error. Unexpected model "
+                                 "type '" + target.modelType() + "', source model type '"
+                                 + source.modelType() + "'");
+
+    std::vector<std::unique_ptr<SessionItem>> items;
+    for (auto child : source.rootItem()->childrenRange()) {
+        auto item = target.factory()->cloneItem(*child, preserve_identifiers);
+        if (!item)
+            return false;
+        items.push_back(std::move(item));
+    }
+
+    auto rebuild_root = [&items](auto parent) {
+        for (auto& item : items)
+            parent->insertItem(item.release(), TagRow::append());
+    };
+    target.clear(rebuild_root);
+    return true;
+}
+
 void Utils::DeleteItemFromModel(SessionItem* item)
 {
     auto model = item->model();
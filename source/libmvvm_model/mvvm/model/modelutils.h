@@ -29,7 +29,7 @@ namespace Utils {
 template <typename T = SessionItem> std::vector<T*> TopItems(const SessionModel* model)
 {
     std::vector<T*> result;
-    for (auto child : model->rootItem()->children()) {
+    for (auto child : model->rootItem()->childrenRange()) {
         if (auto item = dynamic_cast<T*>(child); item)
             result.push_back(item);
     }
@@ -49,16 +49,7 @@ template <typename T = SessionItem> T* TopItem(const SessionModel* model)
 
 template <typename T = SessionItem> std::vector<T*> FindItems(const SessionModel* model)
 {
-    std::vector<T*> result;
-
-    auto func = [&result](SessionItem* item) {
-        if (auto concrete = dynamic_cast<T*>(item); concrete)
-            result.push_back(concrete);
-    };
-
-    iterate(model->rootItem(), func);
-
-    return result;
+    return model->findItems<T>();
 }
 
 //! Constructs path to find given item. Item must belong to a model.
@@ -72,10 +63,19 @@ MVVM_MODEL_EXPORT SessionItem* ItemFromPath(const SessionModel& moodel, const Pa
 MVVM_MODEL_EXPORT void PopulateEmptyModel(const JsonModelConverterInterface* converter,
                                           const SessionModel& source, SessionModel& target);
 
+//! Populates empty model with deep copies of top level items of the source model, made natively by
+//! the item factory of the target. Returns false, leaving the target untouched, if some item can't
+//! be copied this way.
+MVVM_MODEL_EXPORT bool PopulateEmptyModelNative(const SessionModel& source, SessionModel& target,
+                                                bool preserve_identifiers);
+
 //! Creates full deep copy of given model. All item's ID will be generated.
 template <typename T = SessionModel> std::unique_ptr<T> CreateCopy(const T& model)
 {
     auto result = std::make_unique<T>();
+    if (PopulateEmptyModelNative(model, *result.get(), /*preserve_identifiers*/ false))
+        return result;
+
     auto converter = CreateModelCopyConverter();
     PopulateEmptyModel(converter.get(), model, *result.get());
     return result;
@@ -85,6 +85,9 @@ template <typename T = SessionModel> std::unique_ptr<T> CreateCopy(const T& mode
 template <typename T = SessionModel> std::unique_ptr<T> CreateClone(const T& model)
 {
     auto result = std::make_unique<T>();
+    if (PopulateEmptyModelNative(model, *result.get(), /*preserve_identifiers*/ true))
+        return result;
+
     auto converter = CreateModelCloneConverter();
     PopulateEmptyModel(converter.get(), model, *result.get());
     return result;
@@ -14,6 +14,11 @@ using namespace ModelView;
 
 PropertyItem::PropertyItem() : SessionItem(Constants::PropertyType) {}
 
+PropertyItem::PropertyItem(const PropertyItem& prototype, ItemStampTag tag)
+    : SessionItem(prototype, tag)
+{
+}
+
 PropertyItem* PropertyItem::setDisplayName(const std::string& name)
 {
     SessionItem::setDisplayName(name);
@@ -22,6 +22,7 @@ class RealLimits;
 class MVVM_MODEL_EXPORT PropertyItem : public SessionItem {
 public:
     PropertyItem();
+    PropertyItem(const PropertyItem& prototype, ItemStampTag tag);
 
     PropertyItem* setDisplayName(const std::string& name) override;
 
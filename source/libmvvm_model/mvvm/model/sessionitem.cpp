@@ -8,7 +8,9 @@
 // ************************************************************************** //
 
 #include "mvvm/model/sessionitem.h"
+#include "mvvm/commands/commandutils.h"
 #include "mvvm/core/uniqueidgenerator.h"
+#include "mvvm/model/sessionitemcontainer.h"
 #include "mvvm/model/sessionitemdata.h"
 #include "mvvm/model/sessionitemtags.h"
 #include "mvvm/model/sessionmodel.h"
@@ -26,16 +28,29 @@ int appearance(const ModelView::SessionItem& item)
     return item.hasData(ItemDataRole::APPEARANCE) ? item.data<int>(ItemDataRole::APPEARANCE)
                                                   : default_appearance;
 }
+
+//! Empty identifier keeping the place of IDENTIFIER role until generated identifier is formatted.
+//! Shared variant makes the placeholder cheap to copy.
+const Variant& identifier_placeholder()
+{
+    static const Variant result = Variant::fromValue(std::string());
+    return result;
+}
 } // namespace
 
-struct SessionItem::SessionItemImpl {
+struct SessionItem::SessionItemImpl : public ArenaAllocated {
     SessionItem* m_self{nullptr};
     SessionItem* m_parent{nullptr};
     SessionModel* m_model{nullptr};
     std::unique_ptr<ItemMapper> m_mapper;
     std::unique_ptr<SessionItemData> m_data;
     std::unique_ptr<SessionItemTags> m_tags;
-    model_type m_modelType;
+    Symbol m_modelType;
+    const SessionItemContainer* m_container{nullptr}; //!< parent's container holding this item
+    //! Identifier generated on construction, it is formatted into IDENTIFIER data on first request.
+    UniqueId m_generated_id;
+    mutable bool m_id_formatted{false};
+    int m_row_hint{-1}; //!< last known row in m_container, might be outdated
 
     SessionItemImpl(SessionItem* this_item)
         : m_self(this_item)
@@ -44,8 +59,34 @@ struct SessionItem::SessionItemImpl {
     {
     }
 
+    //! Generates new identifier in the binary form, its string form is postponed.
+    void generate_identifier()
+    {
+        m_generated_id = UniqueIdGenerator::generateId();
+        m_id_formatted = false;
+        m_data->setData(identifier_placeholder(), ItemDataRole::IDENTIFIER);
+    }
+
+    //! Puts generated identifier into item's data, if it wasn't done yet.
+    void format_identifier() const
+    {
+        if (m_id_formatted || m_generated_id.isNull())
+            return;
+        m_data->setData(Variant::fromValue(m_generated_id.toString()), ItemDataRole::IDENTIFIER);
+        m_id_formatted = true;
+    }
+
+    //! Forgets generated identifier, when the item gets identifier from outside.
+    void drop_generated_identifier()
+    {
+        m_generated_id = UniqueId();
+        m_id_formatted = false;
+    }
+
     bool do_setData(const Variant& variant, int role)
     {
+        if (role == ItemDataRole::IDENTIFIER)
+            drop_generated_identifier();
         bool result = m_data->setData(variant, role);
         if (result && m_model)
             m_model->mapper()->callOnDataChange(m_self, role);
@@ -55,9 +96,24 @@ struct SessionItem::SessionItemImpl {
 
 SessionItem::SessionItem(model_type modelType) : p_impl(std::make_unique<SessionItemImpl>(this))
 {
-    p_impl->m_modelType = std::move(modelType);
-    setData(UniqueIdGenerator::generate(), ItemDataRole::IDENTIFIER);
-    setData(p_impl->m_modelType, ItemDataRole::DISPLAY);
+    p_impl->m_modelType = Symbol(modelType);
+    p_impl->generate_identifier();
+    setData(modelType, ItemDataRole::DISPLAY);
+}
+
+//! Constructs item with the data and tag layout of the prototype. Children are not copied, and the
+//! new item gets its own identifier. Used by ItemCatalogue to stamp items out of prototypes.
+
+SessionItem::SessionItem(const SessionItem& prototype, ItemStampTag)
+    : ArenaAllocated(), p_impl(std::make_unique<SessionItemImpl>(this))
+{
+    p_impl->m_modelType = prototype.p_impl->m_modelType;
+    *p_impl->m_data = *prototype.p_impl->m_data;
+    p_impl->generate_identifier(); // replaces identifier of the prototype on first request
+
+    const auto& default_tag = prototype.p_impl->m_tags->defaultTag();
+    for (auto container : *prototype.p_impl->m_tags)
+        registerTag(container->tagInfo(), container->name() == default_tag);
 }
 
 SessionItem::~SessionItem()
@@ -71,18 +127,35 @@ SessionItem::~SessionItem()
 
 //! Returns item's model type.
 
-model_type SessionItem::modelType() const
+const model_type& SessionItem::modelType() const
+{
+    return p_impl->m_modelType.str();
+}
+
+//! Returns item's model type in the interned form, suitable for fast comparison and hashing.
+
+Symbol SessionItem::modelTypeSymbol() const
 {
     return p_impl->m_modelType;
 }
 
 //! Returns unique identifier.
 
+//! The string form of the identifier generated on construction is made on the first request.
+
 std::string SessionItem::identifier() const
 {
     return data<std::string>(ItemDataRole::IDENTIFIER);
 }
 
+//! Returns identifier generated on item construction in the binary form, without formatting it.
+//! Returns null UniqueId if the identifier was assigned from outside (e.g. restored from json).
+
+UniqueId SessionItem::generatedId() const
+{
+    return p_impl->m_generated_id;
+}
+
 //! Returns display name.
 
 std::string SessionItem::displayName() const
@@ -131,6 +204,7 @@ bool SessionItem::hasData(int role) const
 
 const SessionItemData* SessionItem::itemData() const
 {
+    p_impl->format_identifier(); // data container is exposed as a whole
     return p_impl->m_data.get();
 }
 
@@ -145,7 +219,7 @@ SessionItemData* SessionItem::itemData()
 
 int SessionItem::childrenCount() const
 {
-    return static_cast<int>(children().size());
+    return p_impl->m_tags->allItemsCount();
 }
 
 //! Returns vector of children formed from all chidlren from all tags.
@@ -155,6 +229,21 @@ std::vector<SessionItem*> SessionItem::children() const
     return p_impl->m_tags->allitems();
 }
 
+//! Returns range of children from all tags. Unlike children(), doesn't copy anything, the range is
+//! invalidated by the insertion or removal of children.
+
+ItemRange SessionItem::childrenRange() const
+{
+    return p_impl->m_tags->itemRange();
+}
+
+//! Returns range of children stored at given tag.
+
+ItemRange SessionItem::childrenRange(const std::string& tag) const
+{
+    return p_impl->m_tags->itemRange(tag);
+}
+
 //! Returns number of items in given tag.
 
 int SessionItem::itemCount(const std::string& tag) const
@@ -166,7 +255,7 @@ int SessionItem::itemCount(const std::string& tag) const
 
 SessionItem* SessionItem::getItem(const std::string& tag, int row) const
 {
-    return p_impl->m_tags->getItem({tag, row});
+    return p_impl->m_tags->itemAt(tag, row);
 }
 
 //! Returns all children stored at given tag.
@@ -220,6 +309,9 @@ bool SessionItem::insertItem(SessionItem* item, const TagRow& tagrow)
     if (item->model())
         throw std::runtime_error("SessionItem::insertItem() -> Existing model.");
 
+    if (p_impl->m_model)
+        p_impl->m_model->mapper()->prepareItemInsert(this, tagrow);
+
     auto result = p_impl->m_tags->insertItem(item, tagrow);
     if (result) {
         item->setParent(this);
@@ -235,6 +327,24 @@ bool SessionItem::insertItem(SessionItem* item, const TagRow& tagrow)
     return result;
 }
 
+//! Inserts items one after another starting from given position. Listeners are notified about the
+//! whole range at once. Nothing is inserted if any of the items can't be inserted.
+
+bool SessionItem::insertItems(const std::vector<SessionItem*>& items, const TagRow& tagrow)
+{
+    if (!p_impl->m_tags->canInsertItems(items, tagrow))
+        return false;
+
+    const auto& tag = tagrow.tag.empty() ? p_impl->m_tags->defaultTag() : tagrow.tag;
+    int row = tagrow.row < 0 ? p_impl->m_tags->itemCount(tag) : tagrow.row;
+    BatchGuard batch(p_impl->m_model);
+    for (auto item : items)
+        insertItem(item, {tag, row++});
+
+    batch.commit();
+    return true;
+}
+
 //! Removes item from given row from given tag, returns it to the caller.
 
 SessionItem* SessionItem::takeItem(const TagRow& tagrow)
@@ -255,6 +365,29 @@ SessionItem* SessionItem::takeItem(const TagRow& tagrow)
     return result;
 }
 
+//! Removes items occupying rows [tagrow.row, tagrow.row + count) of given tag and returns them to
+//! the caller in the order of rows. Listeners are notified about the whole range at once. Nothing
+//! is removed if any of the items can't be taken.
+
+std::vector<SessionItem*> SessionItem::takeItems(const TagRow& tagrow, int count)
+{
+    if (count <= 0 || !p_impl->m_tags->canTakeItems(tagrow, count))
+        return {};
+
+    const TagRow first{tagrow.tag.empty() ? p_impl->m_tags->defaultTag() : tagrow.tag, tagrow.row};
+    BatchGuard batch(p_impl->m_model);
+    if (p_impl->m_model)
+        p_impl->m_model->mapper()->callOnItemsAboutToBeRemoved(this, first, count);
+
+    // taking from the end of the range, so following children are shifted only once
+    std::vector<SessionItem*> result(static_cast<size_t>(count));
+    for (int index = count - 1; index >= 0; --index)
+        result[static_cast<size_t>(index)] = takeItem({first.tag, first.row + index});
+
+    batch.commit();
+    return result;
+}
+
 //! Returns true if this item has `editable` flag set.
 //! The data value of an editable item normally can be changed when it appears in trees and tables.
 
@@ -350,11 +483,13 @@ bool SessionItem::set_data_internal(const Variant& value, int role, bool direct)
 }
 
 //! Returns data for given role. Method invented to hide implementaiton details and avoid
-//! placing sessionitemdata.h into 'sessionitem.h' header.
+//! placing sessionitemdata.h into 'sessionitem.h' header. No copy of the variant is made.
 
-Variant SessionItem::data_internal(int role) const
+const Variant& SessionItem::data_internal(int role) const
 {
-    return p_impl->m_data->data(role);
+    if (role == ItemDataRole::IDENTIFIER)
+        p_impl->format_identifier();
+    return p_impl->m_data->dataRef(role);
 }
 
 void SessionItem::setParent(SessionItem* parent)
@@ -362,6 +497,25 @@ void SessionItem::setParent(SessionItem* parent)
     p_impl->m_parent = parent;
 }
 
+//! Remembers container holding this item and item's row in it. Used by the container to find
+//! the row of the item without the search.
+
+void SessionItem::setPosition(const SessionItemContainer* container, int row)
+{
+    p_impl->m_container = container;
+    p_impl->m_row_hint = row;
+}
+
+const SessionItemContainer* SessionItem::container() const
+{
+    return p_impl->m_container;
+}
+
+int SessionItem::rowHint() const
+{
+    return p_impl->m_row_hint;
+}
+
 void SessionItem::setModel(SessionModel* model)
 {
     if (p_impl->m_model)
@@ -372,10 +526,24 @@ void SessionItem::setModel(SessionModel* model)
     if (p_impl->m_model)
         p_impl->m_model->registerInPool(this);
 
-    for (auto child : children())
+    for (auto child : childrenRange())
         child->setModel(model);
 }
 
+//! Notifies subscribers of this item and all its children that items are gone, and drops item
+//! mappers. Used when the item removed from the model is kept alive for later restore.
+
+void SessionItem::releaseMapper()
+{
+    if (p_impl->m_mapper) {
+        p_impl->m_mapper->callOnItemDestroy();
+        p_impl->m_mapper.reset();
+    }
+
+    for (auto child : childrenRange())
+        child->releaseMapper();
+}
+
 void SessionItem::setAppearanceFlag(int flag, bool value)
 {
     int flags = appearance(*this);
@@ -402,6 +570,7 @@ ItemMapper* SessionItem::mapper()
 void SessionItem::setDataAndTags(std::unique_ptr<SessionItemData> data,
                                  std::unique_ptr<SessionItemTags> tags)
 {
+    p_impl->drop_generated_identifier();
     p_impl->m_data = std::move(data);
     p_impl->m_tags = std::move(tags);
 }
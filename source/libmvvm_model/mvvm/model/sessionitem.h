@@ -10,8 +10,12 @@
 #ifndef MVVM_MODEL_SESSIONITEM_H
 #define MVVM_MODEL_SESSIONITEM_H
 
+#include "mvvm/core/symbol.h"
+#include "mvvm/core/uniqueid.h"
 #include "mvvm/core/variant.h"
 #include "mvvm/model/customvariants.h"
+#include "mvvm/model/itemarena.h"
+#include "mvvm/model/itemrange.h"
 #include "mvvm/model/mvvm_types.h"
 #include "mvvm/model/tagrow.h"
 #include "mvvm/model_export.h"
@@ -26,23 +30,42 @@ class TagInfo;
 class ItemMapper;
 class SessionItemData;
 class SessionItemTags;
+class SessionItemContainer;
+class ItemCatalogue;
+
+//! Tag of the constructor stamping out the copy of the prototype item (see ItemCatalogue). Only the
+//! catalogue can create the tag, so items can't be copied by accident.
+
+//! Item types opt in native copying by declaring public constructor `T(const T&, ItemStampTag)`,
+//! which passes the tag to the same constructor of the base. The constructor has to set up the
+//! state of the item, other than data and children, which are copied by SessionItem.
+
+class MVVM_MODEL_EXPORT ItemStampTag {
+    friend class ItemCatalogue;
+    explicit ItemStampTag() = default;
+};
 
 //! The main object representing an editable/displayable/serializable entity. Serves as a
 //! construction element (node) of SessionModel to represent all the data of GUI application.
 
-class MVVM_MODEL_EXPORT SessionItem {
+class MVVM_MODEL_EXPORT SessionItem : public ArenaAllocated {
 public:
     explicit SessionItem(model_type modelType = Constants::BaseType);
+    SessionItem(const SessionItem& prototype, ItemStampTag);
     virtual ~SessionItem();
     SessionItem(const SessionItem&) = delete;
     SessionItem& operator=(const SessionItem&) = delete;
 
     // basic item properties
 
-    model_type modelType() const;
+    const model_type& modelType() const;
+
+    Symbol modelTypeSymbol() const;
 
     std::string identifier() const;
 
+    UniqueId generatedId() const;
+
     virtual SessionItem* setDisplayName(const std::string& name);
     virtual std::string displayName() const;
 
@@ -70,6 +93,10 @@ public:
 
     std::vector<SessionItem*> children() const;
 
+    ItemRange childrenRange() const;
+
+    ItemRange childrenRange(const std::string& tag) const;
+
     int itemCount(const std::string& tag) const;
 
     SessionItem* getItem(const std::string& tag, int row = 0) const;
@@ -90,8 +117,12 @@ public:
 
     bool insertItem(SessionItem* item, const TagRow& tagrow);
 
+    bool insertItems(const std::vector<SessionItem*>& items, const TagRow& tagrow);
+
     SessionItem* takeItem(const TagRow& tagrow);
 
+    std::vector<SessionItem*> takeItems(const TagRow& tagrow, int count);
+
     // more convenience methods
 
     bool isEditable() const;
@@ -118,12 +149,18 @@ public:
 private:
     friend class SessionModel;
     friend class JsonItemConverter;
+    friend class SessionItemContainer;
+    friend class DetachedItemBackupStrategy;
     virtual void activate() {}
     bool set_data_internal(const Variant& value, int role, bool direct);
-    Variant data_internal(int role) const;
+    const Variant& data_internal(int role) const;
     void setParent(SessionItem* parent);
     void setModel(SessionModel* model);
+    void releaseMapper();
     void setAppearanceFlag(int flag, bool value);
+    void setPosition(const SessionItemContainer* container, int row);
+    const SessionItemContainer* container() const;
+    int rowHint() const;
 
     void setDataAndTags(std::unique_ptr<SessionItemData> data,
                         std::unique_ptr<SessionItemTags> tags);
@@ -167,7 +204,7 @@ template <typename T> inline T* SessionItem::item(const std::string& tag) const
 template <typename T> std::vector<T*> SessionItem::items(const std::string& tag) const
 {
     std::vector<T*> result;
-    for (auto item : getItems(tag))
+    for (auto item : childrenRange(tag))
         if (auto casted = dynamic_cast<T*>(item); casted)
             result.push_back(casted);
     return result;
@@ -9,7 +9,7 @@
 
 #include "mvvm/model/sessionitemcontainer.h"
 #include "mvvm/model/sessionitem.h"
-#include "mvvm/utils/containerutils.h"
+#include <algorithm>
 
 using namespace ModelView;
 
@@ -58,6 +58,11 @@ bool SessionItemContainer::insertItem(SessionItem* item, int index)
         return false;
 
     m_items.insert(std::next(m_items.begin(), index), item);
+    item->setPosition(this, index);
+    if (m_positioned_count == m_items.size() - 1 && index == itemCount() - 1)
+        m_positioned_count = m_items.size(); // appending doesn't invalidate other rows
+    else
+        m_positioned_count = std::min(m_positioned_count, static_cast<size_t>(index));
     return true;
 }
 
@@ -69,8 +74,11 @@ SessionItem* SessionItemContainer::takeItem(int index)
         return nullptr;
 
     SessionItem* result = itemAt(index);
-    if (result)
+    if (result) {
         m_items.erase(std::next(m_items.begin(), index));
+        result->setPosition(nullptr, -1);
+        m_positioned_count = std::min(m_positioned_count, static_cast<size_t>(index));
+    }
 
     return result;
 }
@@ -96,7 +104,15 @@ bool SessionItemContainer::canInsertItem(const SessionItem* item, int index) con
 
 int SessionItemContainer::indexOfItem(const SessionItem* item) const
 {
-    return Utils::IndexOfItem(m_items, item);
+    if (!item || item->container() != this)
+        return -1;
+
+    auto row = item->rowHint();
+    if (row >= 0 && row < itemCount() && m_items[static_cast<size_t>(row)] == item)
+        return row;
+
+    update_positions();
+    return item->rowHint();
 }
 
 //! Returns item at given index. Returns nullptr if index is invalid.
@@ -108,12 +124,12 @@ SessionItem* SessionItemContainer::itemAt(int index) const
 
 //! Returns the name of SessionItemTag.
 
-std::string SessionItemContainer::name() const
+const std::string& SessionItemContainer::name() const
 {
     return m_tag_info.name();
 }
 
-TagInfo SessionItemContainer::tagInfo() const
+const TagInfo& SessionItemContainer::tagInfo() const
 {
     return m_tag_info;
 }
@@ -128,6 +144,15 @@ SessionItemContainer::const_iterator SessionItemContainer::end() const
     return m_items.end();
 }
 
+//! Updates cached rows of items which follow the last inserted or removed item.
+
+void SessionItemContainer::update_positions() const
+{
+    for (size_t index = m_positioned_count; index < m_items.size(); ++index)
+        m_items[index]->setPosition(this, static_cast<int>(index));
+    m_positioned_count = m_items.size();
+}
+
 //! Returns true if no more items are allowed.
 
 bool SessionItemContainer::maximum_reached() const
@@ -146,5 +171,5 @@ bool SessionItemContainer::minimum_reached() const
 
 bool SessionItemContainer::is_valid_item(const SessionItem* item) const
 {
-    return item && m_tag_info.isValidChild(item->modelType());
+    return item && m_tag_info.isValidChild(item->modelTypeSymbol());
 }
@@ -10,6 +10,7 @@
 #ifndef MVVM_MODEL_SESSIONITEMCONTAINER_H
 #define MVVM_MODEL_SESSIONITEMCONTAINER_H
 
+#include "mvvm/model/itemarena.h"
 #include "mvvm/model/taginfo.h"
 #include "mvvm/model_export.h"
 #include <vector>
@@ -20,7 +21,10 @@ class SessionItem;
 
 //! Holds collection of SessionItem objects related to the same tag.
 
-class MVVM_MODEL_EXPORT SessionItemContainer {
+//! Each item remembers its container and row, so the row of the item is found without the search.
+//! Rows of items following inserted or removed ones are updated lazily, on the next request.
+
+class MVVM_MODEL_EXPORT SessionItemContainer : public ArenaAllocated {
 public:
     using container_t = std::vector<SessionItem*>;
     using const_iterator = container_t::const_iterator;
@@ -48,9 +52,9 @@ public:
 
     SessionItem* itemAt(int index) const;
 
-    std::string name() const;
+    const std::string& name() const;
 
-    TagInfo tagInfo() const;
+    const TagInfo& tagInfo() const;
 
     const_iterator begin() const;
 
@@ -60,8 +64,10 @@ private:
     bool maximum_reached() const;
     bool minimum_reached() const;
     bool is_valid_item(const SessionItem* item) const;
+    void update_positions() const;
     TagInfo m_tag_info;
     container_t m_items;
+    mutable size_t m_positioned_count{0}; //!< number of leading items with valid cached row
 };
 
 } // namespace ModelView
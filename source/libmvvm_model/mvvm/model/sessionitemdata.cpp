@@ -10,14 +10,29 @@
 #include "mvvm/model/sessionitemdata.h"
 #include "mvvm/model/customvariants.h"
 #include <algorithm>
+#include <iterator>
 #include <sstream>
 #include <stdexcept>
 
 using namespace ModelView;
 
+namespace {
+const Variant& invalid_variant()
+{
+    static const Variant result;
+    return result;
+}
+} // namespace
+
+SessionItemData::SessionItemData()
+{
+    m_fixed_index.fill(-1);
+}
+
 std::vector<int> SessionItemData::roles() const
 {
     std::vector<int> result;
+    result.reserve(m_values.size());
     for (const auto& value : m_values)
         result.push_back(value.m_role);
     return result;
@@ -25,11 +40,16 @@ std::vector<int> SessionItemData::roles() const
 
 Variant SessionItemData::data(int role) const
 {
-    for (const auto& value : m_values) {
-        if (value.m_role == role)
-            return value.m_data;
-    }
-    return Variant();
+    return dataRef(role);
+}
+
+//! Returns the data for given role without copying. Reference remains valid until the next
+//! setData call. Returns reference to invalid variant if role doesn't exist.
+
+const Variant& SessionItemData::dataRef(int role) const
+{
+    int index = index_of(role);
+    return index < 0 ? invalid_variant() : m_values[static_cast<size_t>(index)].m_data;
 }
 
 //! Sets the data for given role. Returns true if data was changed.
@@ -39,19 +59,29 @@ bool SessionItemData::setData(const Variant& value, int role)
 {
     assure_validity(value, role);
 
-    for (auto it = m_values.begin(); it != m_values.end(); ++it) {
-        if (it->m_role == role) {
-            if (value.isValid()) {
-                if (Utils::IsTheSame(it->m_data, value))
-                    return false;
-                it->m_data = value;
-            }
-            else {
-                m_values.erase(it);
-            }
-            return true;
+    int index = index_of(role);
+    if (index >= 0) {
+        auto it = std::next(m_values.begin(), index);
+        if (value.isValid()) {
+            if (Utils::IsTheSame(it->m_data, value))
+                return false;
+            it->m_data = value;
+        }
+        else {
+            m_values.erase(it);
+            if (role >= 0 && role < fixed_roles_count)
+                m_fixed_index[static_cast<size_t>(role)] = -1;
+            for (auto& pos : m_fixed_index)
+                if (pos > index)
+                    --pos;
         }
+        return true;
     }
+
+    if (m_values.empty())
+        m_values.reserve(fixed_roles_count / 2); // identifier, display and few more
+    if (role >= 0 && role < fixed_roles_count)
+        m_fixed_index[static_cast<size_t>(role)] = static_cast<int16_t>(m_values.size());
     m_values.push_back(DataRole(value, role));
     return true;
 }
@@ -70,8 +100,19 @@ SessionItemData::const_iterator SessionItemData::end() const
 
 bool SessionItemData::hasData(int role) const
 {
+    return index_of(role) >= 0;
+}
+
+//! Returns position of given role in the container, or -1 if role doesn't exist.
+
+int SessionItemData::index_of(int role) const
+{
+    if (role >= 0 && role < fixed_roles_count)
+        return m_fixed_index[static_cast<size_t>(role)];
+
     auto has_role = [role](const auto& x) { return x.m_role == role; };
-    return std::find_if(m_values.begin(), m_values.end(), has_role) != m_values.end();
+    auto it = std::find_if(m_values.begin(), m_values.end(), has_role);
+    return it == m_values.end() ? -1 : static_cast<int>(std::distance(m_values.begin(), it));
 }
 
 //! Check if variant is compatible
@@ -81,10 +122,11 @@ void SessionItemData::assure_validity(const Variant& variant, int role)
     if (variant.typeName() == QStringLiteral("QString"))
         throw std::runtime_error("Attempt to set QString based variant");
 
-    if (!Utils::CompatibleVariantTypes(data(role), variant)) {
+    const auto& current = dataRef(role);
+    if (!Utils::CompatibleVariantTypes(current, variant)) {
         std::ostringstream ostr;
         ostr << "SessionItemData::assure_validity() -> Error. Variant types mismatch. "
-             << "Old variant type '" << data(role).typeName() << "' "
+             << "Old variant type '" << current.typeName() << "' "
              << "new variant type '" << variant.typeName() << "\n";
         throw std::runtime_error(ostr.str());
     }
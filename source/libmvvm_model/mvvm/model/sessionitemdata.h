@@ -11,22 +11,33 @@
 #define MVVM_MODEL_SESSIONITEMDATA_H
 
 #include "mvvm/model/datarole.h"
+#include "mvvm/model/itemarena.h"
+#include "mvvm/model/mvvm_types.h"
 #include "mvvm/model_export.h"
+#include <array>
+#include <cstdint>
 #include <vector>
 
 namespace ModelView {
 
 //! Handles data roles for SessionItem.
 
-class MVVM_MODEL_EXPORT SessionItemData {
+//! Values are kept in the order of their first appearance. Predefined roles (ItemDataRole) are
+//! located via a direct slot index, while user roles are looked up by scanning.
+
+class MVVM_MODEL_EXPORT SessionItemData : public ArenaAllocated {
 public:
     using container_type = std::vector<DataRole>;
     using const_iterator = container_type::const_iterator;
 
+    SessionItemData();
+
     std::vector<int> roles() const;
 
     Variant data(int role) const;
 
+    const Variant& dataRef(int role) const;
+
     bool setData(const Variant& value, int role);
 
     const_iterator begin() const;
@@ -35,8 +46,11 @@ public:
     bool hasData(int role) const;
 
 private:
+    static const int fixed_roles_count = ItemDataRole::EDITORTYPE + 1;
+    int index_of(int role) const;
     void assure_validity(const Variant& variant, int role);
     container_type m_values;
+    std::array<int16_t, fixed_roles_count> m_fixed_index; //!< position in m_values or -1
 };
 
 } // namespace ModelView
@@ -8,11 +8,27 @@
 // ************************************************************************** //
 
 #include "mvvm/model/sessionitemtags.h"
+#include "mvvm/model/sessionitem.h"
 #include "mvvm/model/sessionitemcontainer.h"
+#include <algorithm>
+#include <functional>
+#include <iterator>
 #include <stdexcept>
 
 using namespace ModelView;
 
+namespace {
+
+//! Number of tags up to which containers are found by linear search, without hash table.
+const size_t max_unindexed_tags = 8;
+
+size_t tag_hash(const std::string& name)
+{
+    return std::hash<std::string>{}(name);
+}
+
+} // namespace
+
 SessionItemTags::SessionItemTags() = default;
 
 SessionItemTags::~SessionItemTags()
@@ -28,6 +44,7 @@ void SessionItemTags::registerTag(const TagInfo& tagInfo, bool set_as_default)
                                  + tagInfo.name() + "'");
 
     m_containers.push_back(new SessionItemContainer(tagInfo));
+    rebuild_index();
     if (set_as_default)
         m_default_tag = tagInfo.name();
 }
@@ -36,15 +53,12 @@ void SessionItemTags::registerTag(const TagInfo& tagInfo, bool set_as_default)
 
 bool SessionItemTags::isTag(const std::string& name) const
 {
-    for (auto tag : m_containers)
-        if (tag->name() == name)
-            return true;
-    return false;
+    return find_container(name) != nullptr;
 }
 
 //! Returns the name of the default tag.
 
-std::string SessionItemTags::defaultTag() const
+const std::string& SessionItemTags::defaultTag() const
 {
     return m_default_tag;
 }
@@ -66,7 +80,26 @@ bool SessionItemTags::insertItem(SessionItem* item, const TagRow& tagrow)
 {
     auto tag_container = container(tagrow.tag);
     auto row = tagrow.row < 0 ? tag_container->itemCount() : tagrow.row;
-    return container(tagrow.tag)->insertItem(item, row);
+    return tag_container->insertItem(item, row);
+}
+
+//! Returns true if all items can be inserted one after another starting from given row. Negative
+//! row means appending.
+
+bool SessionItemTags::canInsertItems(const std::vector<SessionItem*>& items,
+                                     const TagRow& tagrow) const
+{
+    auto tag_container = container(tagrow.tag);
+    const auto& tag_info = tag_container->tagInfo();
+    const int item_count = tag_container->itemCount();
+    const int count = static_cast<int>(items.size());
+    if (count == 0 || tagrow.row > item_count)
+        return false;
+    if (tag_info.max() >= 0 && item_count + count > tag_info.max())
+        return false;
+    return std::all_of(items.begin(), items.end(), [&tag_info](auto item) {
+        return item && tag_info.isValidChild(item->modelTypeSymbol());
+    });
 }
 
 //! Removes item at given row and for given tag, returns it to the user.
@@ -83,6 +116,16 @@ bool SessionItemTags::canTakeItem(const TagRow& tagrow) const
     return container(tagrow.tag)->canTakeItem(tagrow.row);
 }
 
+//! Returns true if all items occupying rows [tagrow.row, tagrow.row + count) can be taken.
+
+bool SessionItemTags::canTakeItems(const TagRow& tagrow, int count) const
+{
+    auto tag_container = container(tagrow.tag);
+    const int item_count = tag_container->itemCount();
+    return count > 0 && tagrow.row >= 0 && tagrow.row + count <= item_count
+           && item_count - count >= tag_container->tagInfo().min();
+}
+
 //! Returns item at given row of given tag.
 
 SessionItem* SessionItemTags::getItem(const TagRow& tagrow) const
@@ -90,6 +133,14 @@ SessionItem* SessionItemTags::getItem(const TagRow& tagrow) const
     return container(tagrow.tag)->itemAt(tagrow.row);
 }
 
+//! Returns item at given row of given tag. Same as getItem(), but doesn't require construction of
+//! TagRow object.
+
+SessionItem* SessionItemTags::itemAt(const std::string& tag, int row) const
+{
+    return container(tag)->itemAt(row);
+}
+
 //! Returns vector of items in the container with given name.
 //! If tag name is empty, default tag will be used.
 
@@ -100,13 +151,35 @@ std::vector<SessionItem*> SessionItemTags::getItems(const std::string& tag) cons
 
 std::vector<SessionItem*> SessionItemTags::allitems() const
 {
-    std::vector<SessionItem*> result;
-    for (auto cont : m_containers) {
-        auto container_items = cont->items();
-        result.insert(result.end(), container_items.begin(), container_items.end());
-    }
+    return itemRange().toVector();
+}
+
+//! Returns range of all items, for iteration without copying.
 
-    return result;
+ItemRange SessionItemTags::itemRange() const
+{
+    return {m_containers.begin(), m_containers.end()};
+}
+
+//! Returns range of items in the container with given name. If tag name is empty, default tag
+//! will be used.
+
+ItemRange SessionItemTags::itemRange(const std::string& tag) const
+{
+    const std::string& tagName = tag.empty() ? m_default_tag : tag;
+    int index = find_index(tagName);
+    if (index == -1)
+        throw std::runtime_error("SessionItemTags::itemRange() -> Error. No such container '"
+                                 + tagName + "'");
+    auto first = std::next(m_containers.begin(), index);
+    return {first, std::next(first)};
+}
+
+//! Returns number of items in all containers.
+
+int SessionItemTags::allItemsCount() const
+{
+    return itemRange().size();
 }
 
 //! Returns tag name and row of item in container.
@@ -157,7 +230,7 @@ SessionItemContainer& SessionItemTags::at(int index)
 
 SessionItemContainer* SessionItemTags::container(const std::string& tag_name) const
 {
-    std::string tagName = tag_name.empty() ? defaultTag() : tag_name;
+    const std::string& tagName = tag_name.empty() ? m_default_tag : tag_name;
     auto container = find_container(tagName);
     if (!container)
         throw std::runtime_error("SessionItemTags::container() -> Error. No such container '"
@@ -170,9 +243,50 @@ SessionItemContainer* SessionItemTags::container(const std::string& tag_name) co
 
 SessionItemContainer* SessionItemTags::find_container(const std::string& tag_name) const
 {
-    for (auto cont : m_containers)
-        if (cont->name() == tag_name)
-            return cont;
+    int index = find_index(tag_name);
+    return index == -1 ? nullptr : m_containers[static_cast<size_t>(index)];
+}
+
+//! Returns index of container with given name, or -1 if there is no such container.
+
+int SessionItemTags::find_index(const std::string& tag_name) const
+{
+    if (m_index.empty()) {
+        for (size_t index = 0; index < m_containers.size(); ++index)
+            if (m_containers[index]->name() == tag_name)
+                return static_cast<int>(index);
+        return -1;
+    }
+
+    const size_t mask = m_index.size() - 1;
+    for (size_t pos = tag_hash(tag_name) & mask; m_index[pos] != -1; pos = (pos + 1) & mask) {
+        if (m_containers[static_cast<size_t>(m_index[pos])]->name() == tag_name)
+            return m_index[pos];
+    }
+
+    return -1;
+}
+
+//! Rebuilds hash table of containers. Table size is a power of two and at least twice larger than
+//! the number of containers, so linear probing stays short. Items with few tags have no table.
+
+void SessionItemTags::rebuild_index()
+{
+    if (m_containers.size() <= max_unindexed_tags) {
+        m_index.clear();
+        return;
+    }
 
-    return nullptr;
+    size_t capacity{4};
+    while (capacity < 2 * m_containers.size())
+        capacity *= 2;
+
+    m_index.assign(capacity, -1);
+    const size_t mask = capacity - 1;
+    for (size_t index = 0; index < m_containers.size(); ++index) {
+        size_t pos = tag_hash(m_containers[index]->name()) & mask;
+        while (m_index[pos] != -1)
+            pos = (pos + 1) & mask;
+        m_index[pos] = static_cast<int>(index);
+    }
 }
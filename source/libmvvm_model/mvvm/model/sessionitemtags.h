@@ -10,6 +10,8 @@
 #ifndef MVVM_MODEL_SESSIONITEMTAGS_H
 #define MVVM_MODEL_SESSIONITEMTAGS_H
 
+#include "mvvm/model/itemarena.h"
+#include "mvvm/model/itemrange.h"
 #include "mvvm/model/tagrow.h"
 #include "mvvm/model_export.h"
 #include <string>
@@ -23,7 +25,11 @@ class SessionItem;
 
 //! Collection of SessionItem's containers according to their tags.
 
-class MVVM_MODEL_EXPORT SessionItemTags {
+//! Containers are found by tag name using linear search. Items with many registered tags build
+//! small open addressing hash table instead, so the access to children and properties by tag
+//! doesn't depend on the number of tags.
+
+class MVVM_MODEL_EXPORT SessionItemTags : public ArenaAllocated {
 public:
     using container_t = std::vector<SessionItemContainer*>;
     using const_iterator = container_t::const_iterator;
@@ -39,7 +45,7 @@ public:
 
     bool isTag(const std::string& name) const;
 
-    std::string defaultTag() const;
+    const std::string& defaultTag() const;
 
     void setDefaultTag(const std::string& name);
 
@@ -49,17 +55,29 @@ public:
 
     bool insertItem(SessionItem* item, const TagRow& tagrow);
 
+    bool canInsertItems(const std::vector<SessionItem*>& items, const TagRow& tagrow) const;
+
     SessionItem* takeItem(const TagRow& tagrow);
 
     bool canTakeItem(const TagRow& tagrow) const;
 
+    bool canTakeItems(const TagRow& tagrow, int count) const;
+
     // item access
     SessionItem* getItem(const TagRow& tagrow) const;
 
+    SessionItem* itemAt(const std::string& tag, int row) const;
+
     std::vector<SessionItem*> getItems(const std::string& tag = {}) const;
 
     std::vector<SessionItem*> allitems() const;
 
+    ItemRange itemRange() const;
+
+    ItemRange itemRange(const std::string& tag) const;
+
+    int allItemsCount() const;
+
     TagRow tagRowOfItem(const SessionItem* item) const;
 
     const_iterator begin() const;
@@ -74,7 +92,10 @@ public:
 private:
     SessionItemContainer* container(const std::string& tag_name) const;
     SessionItemContainer* find_container(const std::string& tag_name) const;
+    int find_index(const std::string& tag_name) const;
+    void rebuild_index();
     std::vector<SessionItemContainer*> m_containers;
+    std::vector<int> m_index; //!< hash table of container indices, -1 marks empty slot
     std::string m_default_tag;
 };
 
@@ -10,10 +10,12 @@
 #include "mvvm/model/sessionmodel.h"
 #include "mvvm/commands/commandservice.h"
 #include "mvvm/factories/itemcataloguefactory.h"
+#include "mvvm/model/itemarena.h"
 #include "mvvm/model/itemcatalogue.h"
 #include "mvvm/model/itemfactory.h"
 #include "mvvm/model/itemmanager.h"
 #include "mvvm/model/itempool.h"
+#include "mvvm/model/itemtypeindex.h"
 #include "mvvm/model/sessionitem.h"
 #include "mvvm/model/taginfo.h"
 #include "mvvm/signals/modelmapper.h"
@@ -26,9 +28,12 @@ struct SessionModel::SessionModelImpl {
     SessionModel* m_self{nullptr};
     std::string m_modelType;
     std::unique_ptr<ItemManager> m_itemManager;
+    ItemTypeIndex m_type_index; //!< all items of the model grouped by model type
     std::unique_ptr<CommandService> m_commands;
     std::unique_ptr<ModelMapper> m_mapper;
     std::unique_ptr<SessionItem> m_root_item;
+    bool m_teardown{false};     //!< whole tree is being destroyed
+    bool m_pool_cleared{false}; //!< pool registrations were dropped at once during teardown
     SessionModelImpl(SessionModel* self, std::string modelType, std::shared_ptr<ItemPool> pool)
         : m_self(self)
         , m_modelType(std::move(modelType))
@@ -51,6 +56,25 @@ struct SessionModel::SessionModelImpl {
         m_root_item->setModel(m_self);
         m_root_item->registerTag(TagInfo::universalTag("rootTag"), /*set_as_default*/ true);
     }
+
+    //! Takes the whole tree of items from the model. Item index and pool registrations are
+    //! dropped at once.
+    std::unique_ptr<SessionItem> detachRootItem()
+    {
+        m_type_index.clear();
+        m_pool_cleared = m_itemManager->clearItemPool();
+        return std::move(m_root_item);
+    }
+
+    //! Destroys detached tree of items. Destructors of individual items skip their own
+    //! unregistration.
+    void destroyDetached(std::unique_ptr<SessionItem> root_item)
+    {
+        m_teardown = true;
+        root_item.reset();
+        m_teardown = false;
+        m_pool_cleared = false;
+    }
 };
 
 //! Main c-tor.
@@ -68,7 +92,7 @@ SessionModel::~SessionModel()
     // and we have to keep pimpl pointer intact. Without line below will crash on MacOS because
     // of pecularities of MacOS libc++. See explanations here:
     // http://ibob.github.io/blog/2019/11/07/dont-use-unique_ptr-for-pimpl/
-    p_impl->m_root_item.reset();
+    p_impl->destroyDetached(p_impl->detachRootItem());
 
     p_impl->m_mapper->callOnModelDestroyed();
 }
@@ -83,6 +107,19 @@ SessionItem* SessionModel::insertNewItem(const model_type& modelType, SessionIte
     return intern_insert(create_func, parent, tagrow);
 }
 
+//! Inserts given number of new items of given modelType into consecutive rows of parent's tag,
+//! starting from given row. Insertion is a single undoable command, listeners are notified about
+//! the whole range at once.
+
+std::vector<SessionItem*> SessionModel::insertNewItems(const model_type& modelType,
+                                                       SessionItem* parent, const TagRow& tagrow,
+                                                       int count)
+{
+    // intentionally passing by value inside lambda
+    auto create_func = [this, modelType]() { return factory()->createItem(modelType); };
+    return intern_insert(create_func, parent, tagrow, count);
+}
+
 //! Removes given row from parent.
 
 void SessionModel::removeItem(SessionItem* parent, const TagRow& tagrow)
@@ -90,6 +127,21 @@ void SessionModel::removeItem(SessionItem* parent, const TagRow& tagrow)
     p_impl->m_commands->removeItem(parent, tagrow);
 }
 
+//! Removes items occupying rows [first, last] of parent's tag. Removal is a single undoable
+//! command, listeners are notified about the whole range at once. Returns true on success.
+
+bool SessionModel::removeItems(SessionItem* parent, const std::string& tag, int first, int last)
+{
+    return p_impl->m_commands->removeItems(parent, {tag, first}, last - first + 1);
+}
+
+//! Removes all items of parent's tag in a single undoable command.
+
+bool SessionModel::clearTag(SessionItem* parent, const std::string& tag)
+{
+    return removeItems(parent, tag, 0, parent->itemCount(tag) - 1);
+}
+
 //! Move item from it's current parent to a new parent under given tag and row.
 //! Old and new parents should belong to this model.
 
@@ -120,6 +172,28 @@ bool SessionModel::setData(SessionItem* item, const Variant& value, int role)
     return p_impl->m_commands->setData(item, value, role);
 }
 
+//! Starts the batch of changes. Until the matching endBatch() call, notifications about changes
+//! are collected and coalesced. Batches can be nested.
+
+void SessionModel::beginBatch()
+{
+    mapper()->beginBatch();
+}
+
+//! Ends the batch of changes. Collected notifications are delivered when the outermost batch ends.
+
+void SessionModel::endBatch()
+{
+    mapper()->endBatch();
+}
+
+//! Ends the batch of changes without delivering notifications collected by the outermost batch.
+
+void SessionModel::abortBatch()
+{
+    mapper()->abortBatch();
+}
+
 //! Returns model type.
 
 std::string SessionModel::modelType() const
@@ -162,6 +236,13 @@ SessionItem* SessionModel::findItem(const identifier_type& id)
     return p_impl->m_itemManager->findItem(id);
 }
 
+//! Returns all items of given model type in the order of tree traversal.
+
+std::vector<SessionItem*> SessionModel::findItems(const model_type& modelType) const
+{
+    return p_impl->m_type_index.findItems(modelType);
+}
+
 //! Sets brand new catalog of user-defined items. They become available for undo/redo and
 //! serialization. Internally user catalog will be merged with the catalog of standard items.
 
@@ -180,15 +261,30 @@ void SessionModel::setUndoRedoEnabled(bool value)
     p_impl->m_commands->setUndoRedoEnabled(value);
 }
 
+//! Sets allocation of new items in the model's own memory arena either enabled or disabled. Items
+//! of the model will be kept close to each other, which speeds up building and destruction of
+//! large models. On clear() the new content starts in a fresh arena, and memory of the old one is
+//! released at once after all old items are destroyed. Item destructors still run, since items
+//! own data outside of the arena. By default items are allocated on the heap.
+
+void SessionModel::setArenaAllocationEnabled(bool value)
+{
+    p_impl->m_itemManager->setItemArena(value ? std::make_shared<ItemArena>() : nullptr);
+}
+
 //! Removes all items from the model. If callback is provided, use it to rebuild content of root
-//! item (used while restoring the model from serialized content).
+//! item (used while restoring the model from serialized content). Old items are dropped from the
+//! index and the pool at once, listeners are notified only about the model reset.
 
 void SessionModel::clear(std::function<void(SessionItem*)> callback)
 {
     if (undoStack())
         undoStack()->clear();
     mapper()->callOnModelAboutToBeReset();
+    auto old_root = p_impl->detachRootItem();
+    p_impl->m_itemManager->resetItemArena(); // new tree starts in fresh chunks
     p_impl->createRootItem();
+    p_impl->destroyDetached(std::move(old_root));
     if (callback)
         callback(rootItem());
     mapper()->callOnModelReset();
@@ -199,6 +295,7 @@ void SessionModel::clear(std::function<void(SessionItem*)> callback)
 void SessionModel::registerInPool(SessionItem* item)
 {
     p_impl->m_itemManager->registerInPool(item);
+    p_impl->m_type_index.addItem(item);
     item->activate(); // activates buisiness logic
 }
 
@@ -206,15 +303,47 @@ void SessionModel::registerInPool(SessionItem* item)
 
 void SessionModel::unregisterFromPool(SessionItem* item)
 {
+    // Items of the detached tree were dropped from the index at once, and from the pool too, unless
+    // it is shared with other models. Items of the current tree, i.e. removed by callbacks running
+    // during the teardown, are still indexed and are unregistered as usual.
+    const bool indexed = p_impl->m_type_index.removeItem(item);
+    if (p_impl->m_teardown && !indexed && p_impl->m_pool_cleared)
+        return;
+
     p_impl->m_itemManager->unregisterFromPool(item);
 }
 
+//! Returns items satisfying given criteria in the order of tree traversal.
+
+std::vector<SessionItem*>
+SessionModel::intern_find(const std::function<bool(const SessionItem*)>& match) const
+{
+    return p_impl->m_type_index.findItems(match);
+}
+
 //! Insert new item into given parent using factory function provided.
 
 SessionItem* SessionModel::intern_insert(const item_factory_func_t& func, SessionItem* parent,
                                          const TagRow& tagrow)
 {
-    return p_impl->m_commands->insertNewItem(func, parent, tagrow);
+    // intentionally passing by value inside lambda
+    auto create_func = [manager = p_impl->m_itemManager.get(), func]() {
+        return manager->createItem(func);
+    };
+    return p_impl->m_commands->insertNewItem(create_func, parent, tagrow);
+}
+
+//! Inserts range of new items into given parent using factory function provided.
+
+std::vector<SessionItem*> SessionModel::intern_insert(const item_factory_func_t& func,
+                                                      SessionItem* parent, const TagRow& tagrow,
+                                                      int count)
+{
+    // intentionally passing by value inside lambda
+    auto create_func = [manager = p_impl->m_itemManager.get(), func]() {
+        return manager->createItem(func);
+    };
+    return p_impl->m_commands->insertNewItems(create_func, parent, tagrow, count);
 }
 
 void SessionModel::intern_register(const model_type& modelType, const item_factory_func_t& func,
@@ -43,8 +43,18 @@ public:
 
     template <typename T> T* insertItem(SessionItem* parent = nullptr, const TagRow& tagrow = {});
 
+    std::vector<SessionItem*> insertNewItems(const model_type& modelType, SessionItem* parent,
+                                             const TagRow& tagrow, int count);
+
+    template <typename T>
+    std::vector<T*> insertItems(SessionItem* parent, const TagRow& tagrow, int count);
+
     void removeItem(SessionItem* parent, const TagRow& tagrow);
 
+    bool removeItems(SessionItem* parent, const std::string& tag, int first, int last);
+
+    bool clearTag(SessionItem* parent, const std::string& tag);
+
     void moveItem(SessionItem* item, SessionItem* new_parent, const TagRow& tagrow);
 
     SessionItem* copyItem(const SessionItem* item, SessionItem* parent, const TagRow& tagrow = {});
@@ -53,6 +63,12 @@ public:
 
     bool setData(SessionItem* item, const Variant& value, int role);
 
+    void beginBatch();
+
+    void endBatch();
+
+    void abortBatch();
+
     // Various getters.
 
     std::string modelType() const;
@@ -67,6 +83,10 @@ public:
 
     SessionItem* findItem(const identifier_type& id);
 
+    template <typename T = SessionItem> std::vector<T*> findItems() const;
+
+    std::vector<SessionItem*> findItems(const model_type& modelType) const;
+
     template <typename T = SessionItem> std::vector<T*> topItems() const;
 
     template <typename T = SessionItem> T* topItem() const;
@@ -77,6 +97,8 @@ public:
 
     void setUndoRedoEnabled(bool value);
 
+    void setArenaAllocationEnabled(bool value);
+
     void clear(std::function<void(SessionItem*)> callback = {});
 
     template <typename T> void registerItem(const std::string& label = {});
@@ -85,8 +107,12 @@ private:
     friend class SessionItem;
     void registerInPool(SessionItem* item);
     void unregisterFromPool(SessionItem* item);
+    std::vector<SessionItem*>
+    intern_find(const std::function<bool(const SessionItem*)>& match) const;
     SessionItem* intern_insert(const item_factory_func_t& func, SessionItem* parent,
                                const TagRow& tagrow);
+    std::vector<SessionItem*> intern_insert(const item_factory_func_t& func, SessionItem* parent,
+                                            const TagRow& tagrow, int count);
     void intern_register(const model_type& modelType, const item_factory_func_t& func,
                          const std::string& label);
 
@@ -101,13 +127,38 @@ template <typename T> T* SessionModel::insertItem(SessionItem* parent, const Tag
     return static_cast<T*>(intern_insert(ItemFactoryFunction<T>(), parent, tagrow));
 }
 
+//! Inserts given number of items into consecutive rows of parent's tag, starting from given row.
+//! Insertion is a single undoable command, listeners are notified about the whole range at once.
+
+template <typename T>
+std::vector<T*> SessionModel::insertItems(SessionItem* parent, const TagRow& tagrow, int count)
+{
+    std::vector<T*> result;
+    for (auto item : intern_insert(ItemFactoryFunction<T>(), parent, tagrow, count))
+        result.push_back(static_cast<T*>(item));
+    return result;
+}
+
+//! Returns all items of the given type (including derived types) in the order of tree traversal.
+//! Items are taken from the index of model types, without visiting all items of the model.
+
+template <typename T> std::vector<T*> SessionModel::findItems() const
+{
+    auto match = [](const SessionItem* item) { return dynamic_cast<const T*>(item) != nullptr; };
+
+    std::vector<T*> result;
+    for (auto item : intern_find(match))
+        result.push_back(static_cast<T*>(item));
+    return result;
+}
+
 //! Returns top items of the given type.
 //! The top item is an item that is a child of an invisible root item.
 
 template <typename T> std::vector<T*> SessionModel::topItems() const
 {
     std::vector<T*> result;
-    for (auto child : rootItem()->children()) {
+    for (auto child : rootItem()->childrenRange()) {
         if (auto item = dynamic_cast<T*>(child))
             result.push_back(item);
     }
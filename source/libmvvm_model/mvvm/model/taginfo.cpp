@@ -8,76 +8,165 @@
 // ************************************************************************** //
 
 #include "mvvm/model/taginfo.h"
-#include "mvvm/utils/containerutils.h"
+#include <algorithm>
+#include <memory>
+#include <mutex>
 #include <sstream>
 #include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
 
-ModelView::TagInfo::TagInfo() : m_min(0), m_max(-1) {}
+using namespace ModelView;
 
-ModelView::TagInfo::TagInfo(std::string name, int min, int max, std::vector<std::string> modelTypes)
-    : m_name(std::move(name)), m_min(min), m_max(max), m_modelTypes(std::move(modelTypes))
+//! Immutable tag definition shared by all TagInfo objects with the same content.
+
+struct TagInfo::Schema {
+    std::string name;
+    int min{0};
+    int max{-1};
+    std::vector<std::string> model_types;
+    std::vector<Symbol> model_type_symbols;
+    std::unordered_set<Symbol> model_type_set; //!< for long lists of allowed types
+};
+
+namespace {
+
+//! Lists of allowed model types up to this length are searched linearly.
+const size_t linear_search_limit = 4;
+
+//! Returns key identifying tag definition in the registry.
+std::string schema_key(const std::string& name, int min, int max,
+                       const std::vector<std::string>& model_types)
+{
+    std::string result = name;
+    result.append(1, '\0').append(std::to_string(min)).append(1, '\0');
+    result.append(std::to_string(max));
+    for (const auto& model_type : model_types)
+        result.append(1, '\0').append(model_type);
+    return result;
+}
+
+} // namespace
+
+TagInfo::TagInfo()
+{
+    static const Schema default_schema;
+    m_schema = &default_schema;
+}
+
+TagInfo::TagInfo(std::string name, int min, int max, std::vector<std::string> modelTypes)
 {
-    if (m_min < 0 || (m_min > m_max && m_max >= 0) || m_name.empty()) {
+    if (min < 0 || (min > max && max >= 0) || name.empty()) {
         std::ostringstream ostr;
         ostr << "Invalid constructor parameters"
-             << " " << m_name << " " << m_min << " " << m_max;
+             << " " << name << " " << min << " " << max;
         throw std::runtime_error(ostr.str());
     }
+    m_schema = intern(std::move(name), min, max, std::move(modelTypes));
 }
 
-ModelView::TagInfo ModelView::TagInfo::universalTag(std::string name,
-                                                    std::vector<std::string> modelTypes)
+TagInfo TagInfo::universalTag(std::string name, std::vector<std::string> modelTypes)
 {
     return TagInfo(std::move(name), 0, -1, std::move(modelTypes));
 }
 
-ModelView::TagInfo ModelView::TagInfo::propertyTag(std::string name, std::string model_type)
+TagInfo TagInfo::propertyTag(std::string name, std::string model_type)
 {
     return TagInfo(std::move(name), 1, 1, {std::move(model_type)});
 }
 
-std::string ModelView::TagInfo::name() const
+const std::string& TagInfo::name() const
 {
-    return m_name;
+    return m_schema->name;
 }
 
-int ModelView::TagInfo::min() const
+int TagInfo::min() const
 {
-    return m_min;
+    return m_schema->min;
 }
 
-int ModelView::TagInfo::max() const
+int TagInfo::max() const
 {
-    return m_max;
+    return m_schema->max;
 }
 
-std::vector<std::string> ModelView::TagInfo::modelTypes() const
+std::vector<std::string> TagInfo::modelTypes() const
 {
-    return m_modelTypes;
+    return m_schema->model_types;
 }
 
 //! Returns true if given modelType matches the list of possible model types.
 
-bool ModelView::TagInfo::isValidChild(const std::string& modelType) const
+bool TagInfo::isValidChild(const std::string& modelType) const
 {
-    return m_modelTypes.empty() ? true : Utils::Contains(m_modelTypes, modelType);
+    const auto& model_types = m_schema->model_types;
+    if (model_types.empty())
+        return true;
+    if (model_types.size() <= linear_search_limit)
+        return std::find(model_types.begin(), model_types.end(), modelType) != model_types.end();
+    auto symbol = Symbol::find(modelType);
+    return !symbol.empty() && m_schema->model_type_set.count(symbol) > 0;
+}
+
+//! Returns true if given modelType matches the list of possible model types. Faster version
+//! comparing interned strings.
+
+bool TagInfo::isValidChild(Symbol modelType) const
+{
+    const auto& symbols = m_schema->model_type_symbols;
+    if (symbols.empty())
+        return true;
+    if (symbols.size() <= linear_search_limit)
+        return std::find(symbols.begin(), symbols.end(), modelType) != symbols.end();
+    return m_schema->model_type_set.count(modelType) > 0;
 }
 
 //! Returns true if this tag is used to store single properties.
 //! Properties are children that are created in SessionItem constructor using ::addProperty method.
 
-bool ModelView::TagInfo::isSinglePropertyTag() const
+bool TagInfo::isSinglePropertyTag() const
 {
-    return m_min == 1 && m_max == 1;
+    return m_schema->min == 1 && m_schema->max == 1;
 }
 
-bool ModelView::TagInfo::operator==(const ModelView::TagInfo& other) const
+//! Returns schema with given content from process-wide registry, creating it on first request.
+//! Schemas are never released, their number is limited by the number of distinct tag definitions
+//! in the application.
+
+const TagInfo::Schema* TagInfo::intern(std::string name, int min, int max,
+                                       std::vector<std::string> modelTypes)
+{
+    static std::mutex mutex;
+    static std::unordered_map<std::string, std::unique_ptr<Schema>> registry;
+
+    auto key = schema_key(name, min, max, modelTypes);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (auto it = registry.find(key); it != registry.end())
+        return it->second.get();
+
+    auto schema = std::make_unique<Schema>();
+    schema->name = std::move(name);
+    schema->min = min;
+    schema->max = max;
+    schema->model_types = std::move(modelTypes);
+    for (const auto& model_type : schema->model_types)
+        schema->model_type_symbols.emplace_back(model_type);
+    if (schema->model_types.size() > linear_search_limit)
+        schema->model_type_set.insert(schema->model_type_symbols.begin(),
+                                      schema->model_type_symbols.end());
+    return registry.emplace(std::move(key), std::move(schema)).first->second.get();
+}
+
+//! Returns true if both tags have the same content. Thanks to interning, it is a pointer
+//! comparison.
+
+bool TagInfo::operator==(const TagInfo& other) const
 {
-    return m_name == other.m_name && m_min == other.m_min && m_max == other.m_max
-           && m_modelTypes == other.m_modelTypes;
+    return m_schema == other.m_schema;
 }
 
-bool ModelView::TagInfo::operator!=(const ModelView::TagInfo& other) const
+bool TagInfo::operator!=(const TagInfo& other) const
 {
     return !(*this == other);
 }
@@ -10,6 +10,7 @@
 #ifndef MVVM_MODEL_TAGINFO_H
 #define MVVM_MODEL_TAGINFO_H
 
+#include "mvvm/core/symbol.h"
 #include "mvvm/model_export.h"
 #include <string>
 #include <vector>
@@ -20,6 +21,10 @@ namespace ModelView {
 //! The tag specifies information about children that can be added to a SessionItem. A tag has a
 //! name, min, max allowed number of children, and vector of all modelTypes that children can have.
 
+//! Tag definitions are interned in a process-wide registry of immutable schemas, and TagInfo is
+//! merely a pointer to one of them. Items of the same type share their tag metadata, copying
+//! TagInfo is cheap, and comparison is done by pointer.
+
 class MVVM_MODEL_EXPORT TagInfo {
 public:
     TagInfo();
@@ -32,7 +37,7 @@ public:
     //! Constructs tag intended for single property.
     static TagInfo propertyTag(std::string name, std::string model_type);
 
-    std::string name() const;
+    const std::string& name() const;
 
     int min() const;
 
@@ -44,16 +49,18 @@ public:
 
     bool isValidChild(const std::string& modelType) const;
 
+    bool isValidChild(Symbol modelType) const;
+
     bool isSinglePropertyTag() const;
 
     bool operator==(const TagInfo& other) const;
     bool operator!=(const TagInfo& other) const;
 
 private:
-    std::string m_name;
-    int m_min;
-    int m_max;
-    std::vector<std::string> m_modelTypes;
+    struct Schema;
+    static const Schema* intern(std::string name, int min, int max,
+                                std::vector<std::string> modelTypes);
+    const Schema* m_schema{nullptr};
 };
 
 } // namespace ModelView
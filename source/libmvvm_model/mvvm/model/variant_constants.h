@@ -23,6 +23,7 @@ const std::string int_type_name = "int";
 const std::string string_type_name = "std::string";
 const std::string double_type_name = "double";
 const std::string vector_double_type_name = "std::vector<double>";
+const std::string double_array_type_name = "ModelView::DoubleArray";
 const std::string comboproperty_type_name = "ModelView::ComboProperty";
 const std::string qcolor_type_name = "QColor";
 const std::string extproperty_type_name = "ModelView::ExternalProperty";
@@ -8,6 +8,8 @@
 // ************************************************************************** //
 
 #include "mvvm/project/modelhaschangedcontroller.h"
+#include "mvvm/model/sessionmodel.h"
+#include "mvvm/signals/modelmapper.h"
 
 using namespace ModelView;
 
@@ -21,6 +23,7 @@ ModelHasChangedController::ModelHasChangedController(SessionModel* model, callba
     setOnItemInserted([this](auto, auto) { process_change(); });
     setOnItemRemoved([this](auto, auto) { process_change(); });
     setOnModelReset([this](auto) { process_change(); });
+    setOnBatchFinished([this](auto) { process_batch_finished(); });
 }
 
 //! Returns true if the model was changed since last call of resetChanged.
@@ -42,6 +45,23 @@ void ModelHasChangedController::resetChanged()
 void ModelHasChangedController::process_change()
 {
     m_has_changed = true;
+    if (model()->mapper()->isBatching()) {
+        m_changed_in_batch = true;
+        return;
+    }
+
+    if (m_callback)
+        m_callback();
+}
+
+//! Reports back to client about changes made during the batch.
+
+void ModelHasChangedController::process_batch_finished()
+{
+    if (!m_changed_in_batch)
+        return;
+
+    m_changed_in_batch = false;
     if (m_callback)
         m_callback();
 }
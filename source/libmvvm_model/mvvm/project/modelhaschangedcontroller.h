@@ -17,7 +17,8 @@ namespace ModelView {
 
 //! Tracks changes in the model.
 //! Allows to check if model has been changed (e.g. modified, inserted or removed items) since last
-//! call of ::resetChanged().
+//! call of ::resetChanged(). Inside the batch of changes the client is informed only once, when
+//! the batch is finished.
 
 class MVVM_MODEL_EXPORT ModelHasChangedController : public ModelListener<SessionModel> {
 public:
@@ -30,7 +31,9 @@ public:
 
 private:
     void process_change();
+    void process_batch_finished();
     bool m_has_changed{false};
+    bool m_changed_in_batch{false};
     callback_t m_callback; //! informs the user about change in the model
 };
 
@@ -10,13 +10,40 @@
 #include "mvvm/serialization/jsonitembackupstrategy.h"
 #include "mvvm/factories/itemconverterfactory.h"
 #include "mvvm/model/sessionitem.h"
+#include <QJsonArray>
 #include <QJsonObject>
 
 using namespace ModelView;
 
+namespace {
+
+//! Returns estimated number of bytes occupied by json value together with its content.
+size_t json_footprint(const QJsonValue& value)
+{
+    size_t result = sizeof(QJsonValue);
+    if (value.isString()) {
+        result += static_cast<size_t>(value.toString().size()) * sizeof(QChar);
+    }
+    else if (value.isArray()) {
+        for (const auto& x : value.toArray())
+            result += json_footprint(x);
+    }
+    else if (value.isObject()) {
+        auto object = value.toObject();
+        for (auto it = object.begin(); it != object.end(); ++it)
+            result += static_cast<size_t>(it.key().size()) * sizeof(QChar)
+                      + json_footprint(it.value());
+    }
+    return result;
+}
+
+} // namespace
+
 struct JsonItemBackupStrategy::JsonItemBackupStrategyImpl {
     std::unique_ptr<JsonItemConverterInterface> m_converter;
     QJsonObject m_json;
+    QJsonArray m_json_array;
+    size_t m_footprint{0};
 };
 
 JsonItemBackupStrategy::JsonItemBackupStrategy(const ItemFactoryInterface* item_factory)
@@ -27,7 +54,7 @@ JsonItemBackupStrategy::JsonItemBackupStrategy(const ItemFactoryInterface* item_
 
 JsonItemBackupStrategy::~JsonItemBackupStrategy() = default;
 
-std::unique_ptr<SessionItem> JsonItemBackupStrategy::restoreItem() const
+std::unique_ptr<SessionItem> JsonItemBackupStrategy::restoreItem()
 {
     return p_impl->m_converter->from_json(p_impl->m_json);
 }
@@ -35,4 +62,46 @@ std::unique_ptr<SessionItem> JsonItemBackupStrategy::restoreItem() const
 void JsonItemBackupStrategy::saveItem(const SessionItem* item)
 {
     p_impl->m_json = p_impl->m_converter->to_json(item);
+    p_impl->m_footprint = json_footprint(p_impl->m_json);
+}
+
+std::vector<std::unique_ptr<SessionItem>> JsonItemBackupStrategy::restoreItems()
+{
+    std::vector<std::unique_ptr<SessionItem>> result;
+    result.reserve(static_cast<size_t>(p_impl->m_json_array.size()));
+    for (const auto& json : p_impl->m_json_array)
+        result.push_back(p_impl->m_converter->from_json(json.toObject()));
+    return result;
+}
+
+void JsonItemBackupStrategy::saveItems(const std::vector<const SessionItem*>& items)
+{
+    QJsonArray array;
+    for (auto item : items)
+        array.append(p_impl->m_converter->to_json(item));
+    p_impl->m_json_array = array;
+    p_impl->m_footprint = json_footprint(p_impl->m_json_array);
+}
+
+//! Saves item's content, the item itself is destroyed.
+
+void JsonItemBackupStrategy::keepItem(std::unique_ptr<SessionItem> item)
+{
+    saveItem(item.get());
+}
+
+//! Saves content of items, the items themselves are destroyed.
+
+void JsonItemBackupStrategy::keepItems(std::vector<std::unique_ptr<SessionItem>> items)
+{
+    std::vector<const SessionItem*> raw_items;
+    raw_items.reserve(items.size());
+    for (const auto& item : items)
+        raw_items.push_back(item.get());
+    saveItems(raw_items);
+}
+
+size_t JsonItemBackupStrategy::memoryFootprint() const
+{
+    return p_impl->m_footprint;
 }
@@ -25,10 +25,20 @@ public:
     JsonItemBackupStrategy(const ItemFactoryInterface* item_factory);
     ~JsonItemBackupStrategy() override;
 
-    std::unique_ptr<SessionItem> restoreItem() const override;
+    std::unique_ptr<SessionItem> restoreItem() override;
 
     void saveItem(const SessionItem* item) override;
 
+    std::vector<std::unique_ptr<SessionItem>> restoreItems() override;
+
+    void saveItems(const std::vector<const SessionItem*>& items) override;
+
+    void keepItem(std::unique_ptr<SessionItem> item) override;
+
+    void keepItems(std::vector<std::unique_ptr<SessionItem>> items) override;
+
+    size_t memoryFootprint() const override;
+
 private:
     struct JsonItemBackupStrategyImpl;
     std::unique_ptr<JsonItemBackupStrategyImpl> p_impl;
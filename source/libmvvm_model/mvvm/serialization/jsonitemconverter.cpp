@@ -8,7 +8,6 @@
 // ************************************************************************** //
 
 #include "mvvm/serialization/jsonitemconverter.h"
-#include "mvvm/core/uniqueidgenerator.h"
 #include "mvvm/interfaces/itemfactoryinterface.h"
 #include "mvvm/model/sessionitem.h"
 #include "mvvm/model/sessionitemdata.h"
@@ -79,6 +78,10 @@ struct JsonItemConverter::JsonItemConverterImpl {
         if (modelType != item.modelType())
             throw std::runtime_error("Item model mismatch");
 
+        // identifier generated during item construction is unique already, keeping it
+        const bool regenerate_id = isRegenerateIdWhenBackFromJson(m_context.m_mode);
+        const auto fresh_identifier = regenerate_id ? item.identifier() : identifier_type();
+
         if (isRebuildItemDataAndTagFromJson(m_context.m_mode)) {
             item.setDataAndTags(std::make_unique<SessionItemData>(),
                                 std::make_unique<SessionItemTags>());
@@ -87,11 +90,11 @@ struct JsonItemConverter::JsonItemConverterImpl {
         populate_item_data(json[JsonItemFormatAssistant::itemDataKey].toArray(), *item.itemData());
         populate_item_tags(json[JsonItemFormatAssistant::itemTagsKey].toObject(), *item.itemTags());
 
-        for (auto child : item.children())
+        for (auto child : item.childrenRange())
             child->setParent(&item);
 
-        if (isRegenerateIdWhenBackFromJson(m_context.m_mode))
-            item.setData(UniqueIdGenerator::generate(), ItemDataRole::IDENTIFIER);
+        if (regenerate_id)
+            item.setData(fresh_identifier, ItemDataRole::IDENTIFIER);
     }
 
     QJsonObject item_to_json(const SessionItem& item) const
@@ -9,18 +9,21 @@
 
 #include "mvvm/serialization/jsonitemcopystrategy.h"
 #include "mvvm/factories/itemconverterfactory.h"
+#include "mvvm/interfaces/itemfactoryinterface.h"
 #include "mvvm/model/sessionitem.h"
 #include <QJsonObject>
 
 using namespace ModelView;
 
 struct JsonItemCopyStrategy::JsonItemCopyStrategyImpl {
+    const ItemFactoryInterface* m_factory{nullptr};
     std::unique_ptr<JsonItemConverterInterface> m_converter;
 };
 
 JsonItemCopyStrategy::JsonItemCopyStrategy(const ItemFactoryInterface* item_factory)
     : p_impl(std::make_unique<JsonItemCopyStrategyImpl>())
 {
+    p_impl->m_factory = item_factory;
     p_impl->m_converter = CreateItemCopyConverter(item_factory);
 }
 
@@ -28,6 +31,9 @@ JsonItemCopyStrategy::~JsonItemCopyStrategy() = default;
 
 std::unique_ptr<SessionItem> JsonItemCopyStrategy::createCopy(const SessionItem* item) const
 {
+    if (auto result = p_impl->m_factory->cloneItem(*item, /*preserve_identifiers*/ false); result)
+        return result;
+
     auto json = p_impl->m_converter->to_json(item);
     return p_impl->m_converter->from_json(json);
 }
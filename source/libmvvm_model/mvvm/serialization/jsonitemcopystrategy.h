@@ -18,7 +18,8 @@ namespace ModelView {
 class SessionItem;
 class ItemFactoryInterface;
 
-//! Provide SessionItem copying using json based strategy.
+//! Provide SessionItem copying using json based strategy. Items whose types explicitly opted in
+//! native copying (see ItemFactoryInterface::cloneItem) bypass json.
 
 class MVVM_MODEL_EXPORT JsonItemCopyStrategy : public ItemCopyStrategy {
 public:
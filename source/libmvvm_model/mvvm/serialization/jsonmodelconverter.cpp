@@ -52,7 +52,7 @@ QJsonObject JsonModelConverter::to_json(const SessionModel& model) const
 
     auto itemConverter = CreateConverter(model.factory(), m_mode);
 
-    for (auto item : model.rootItem()->children())
+    for (auto item : model.rootItem()->childrenRange())
         itemArray.append(itemConverter->to_json(item));
 
     result[JsonItemFormatAssistant::itemsKey] = itemArray;
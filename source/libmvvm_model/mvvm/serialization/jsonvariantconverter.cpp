@@ -10,6 +10,7 @@
 #include "mvvm/serialization/jsonvariantconverter.h"
 #include "mvvm/model/comboproperty.h"
 #include "mvvm/model/customvariants.h"
+#include "mvvm/model/doublearray.h"
 #include "mvvm/model/externalproperty.h"
 #include "mvvm/model/variant_constants.h"
 #include "mvvm/serialization/jsonutils.h"
@@ -53,6 +54,9 @@ Variant to_double(const QJsonObject& object);
 QJsonObject from_vector_double(const Variant& variant);
 Variant to_vector_double(const QJsonObject& object);
 
+QJsonObject from_double_array(const Variant& variant);
+Variant to_double_array(const QJsonObject& object);
+
 QJsonObject from_comboproperty(const Variant& variant);
 Variant to_comboproperty(const QJsonObject& object);
 
@@ -75,6 +79,7 @@ JsonVariantConverter::JsonVariantConverter()
     m_converters[Constants::string_type_name] = {from_string, to_string};
     m_converters[Constants::double_type_name] = {from_double, to_double};
     m_converters[Constants::vector_double_type_name] = {from_vector_double, to_vector_double};
+    m_converters[Constants::double_array_type_name] = {from_double_array, to_double_array};
     m_converters[Constants::comboproperty_type_name] = {from_comboproperty, to_comboproperty};
     m_converters[Constants::qcolor_type_name] = {from_qcolor, to_qcolor};
     m_converters[Constants::extproperty_type_name] = {from_extproperty, to_extproperty};
@@ -214,6 +219,29 @@ Variant to_vector_double(const QJsonObject& object)
     return Variant::fromValue(vec);
 }
 
+// --- DoubleArray ------
+
+QJsonObject from_double_array(const Variant& variant)
+{
+    QJsonObject result;
+    result[variantTypeKey] = QString::fromStdString(Constants::double_array_type_name);
+    QJsonArray array;
+    auto data = variant.value<DoubleArray>(); // shares the buffer, no copy of values
+    std::copy(data.begin(), data.end(), std::back_inserter(array));
+    result[variantValueKey] = array;
+    return result;
+}
+
+Variant to_double_array(const QJsonObject& object)
+{
+    auto array = object[variantValueKey].toArray();
+    std::vector<double> vec;
+    vec.reserve(static_cast<size_t>(array.size()));
+    for (auto x : array)
+        vec.push_back(x.toDouble());
+    return Variant::fromValue(DoubleArray(std::move(vec)));
+}
+
 // --- ComboProperty ------
 
 QJsonObject from_comboproperty(const Variant& variant)
@@ -11,6 +11,7 @@
 #define MVVM_SIGNALS_CALLBACK_TYPES_H
 
 #include "mvvm/model/tagrow.h"
+#include <cstdint>
 #include <functional>
 #include <string>
 
@@ -23,11 +24,29 @@ namespace Callbacks {
 using slot_t = const void*;
 using item_t = std::function<void(SessionItem*)>;
 using item_int_t = std::function<void(SessionItem*, int)>;
-using item_str_t = std::function<void(SessionItem*, std::string)>;
-using item_tagrow_t = std::function<void(SessionItem*, TagRow)>;
+using item_str_t = std::function<void(SessionItem*, const std::string&)>;
+using item_tagrow_t = std::function<void(SessionItem*, const TagRow&)>;
+using item_range_t = std::function<void(SessionItem*, const TagRow&, int)>;
 using model_t = std::function<void(SessionModel*)>;
 } // namespace Callbacks
 
+//! Handle of the connection to the signal. Can be used to disconnect a single callback.
+//! Handle becomes stale after the disconnection, so it can't affect later connections.
+
+struct SignalConnection {
+    const void* m_signal{nullptr}; //!< signal which has issued the handle
+    uint32_t m_index{UINT32_MAX};
+    uint32_t m_generation{0};
+
+    bool isValid() const { return m_signal != nullptr; }
+
+    bool operator==(const SignalConnection& other) const
+    {
+        return m_signal == other.m_signal && m_index == other.m_index
+               && m_generation == other.m_generation;
+    }
+};
+
 } // namespace ModelView
 
 #endif // MVVM_SIGNALS_CALLBACK_TYPES_H
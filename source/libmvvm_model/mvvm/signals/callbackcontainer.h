@@ -13,8 +13,10 @@
 #include "mvvm/model_export.h"
 #include "mvvm/signals/callback_types.h"
 #include <algorithm>
+#include <cstdint>
 #include <functional>
-#include <list>
+#include <iterator>
+#include <vector>
 
 namespace ModelView {
 
@@ -23,41 +25,211 @@ class SessionModel;
 
 //! Container to hold callbacks in the context of ModelMapper.
 
+//! Callbacks are stored in a contiguous vector in the order of connection. Callbacks can connect
+//! and disconnect (themselves or others) while the signal is being emitted: new connections are
+//! postponed until the end of the emission, disconnected slots are only marked as inactive and
+//! compacted later.
+
 template <typename T, typename U> class SignalBase {
 public:
     SignalBase() = default;
+    SignalBase(const SignalBase&) = delete;
+    SignalBase& operator=(const SignalBase&) = delete;
+
+    SignalConnection connect(T callback, U client);
+
+    template <typename... Args> void operator()(const Args&... args);
 
-    void connect(T callback, U client);
+    void disconnect(SignalConnection connection);
 
-    template <typename... Args> void operator()(Args... args);
+    bool isConnected(SignalConnection connection) const;
 
     void remove_client(U client);
 
+    size_t size() const;
+
 private:
-    std::list<std::pair<T, U>> m_callbacks;
+    struct Slot {
+        T m_callback;
+        U m_client;
+        uint32_t m_handle{0};
+        bool m_active{true};
+    };
+
+    struct Handle {
+        uint32_t m_position{0}; //!< position in m_slots, followed by m_pending
+        uint32_t m_generation{0};
+        bool m_used{false};
+    };
+
+    //! Restores emission state even if callback throws.
+    struct EmissionGuard {
+        SignalBase* m_signal{nullptr};
+        explicit EmissionGuard(SignalBase* signal) : m_signal(signal)
+        {
+            ++m_signal->m_emission_depth;
+        }
+        ~EmissionGuard()
+        {
+            --m_signal->m_emission_depth;
+            m_signal->cleanup();
+        }
+    };
+
+    Slot* slot_at(uint32_t position);
+    void deactivate(Slot& slot);
+    void cleanup();
+
+    std::vector<Slot> m_slots;
+    std::vector<Slot> m_pending; //!< connections made during emission
+    std::vector<Handle> m_handles;
+    std::vector<uint32_t> m_free_handles;
+    size_t m_inactive_count{0};
+    int m_emission_depth{0};
+    bool m_has_deferred_release{false}; //!< callbacks were disconnected during the emission
 };
 
-template <typename T, typename U> void SignalBase<T, U>::connect(T callback, U client)
+//! Connects callback and returns the handle to the connection.
+
+template <typename T, typename U>
+SignalConnection SignalBase<T, U>::connect(T callback, U client)
 {
-    m_callbacks.push_back(std::make_pair(callback, client));
+    uint32_t index{0};
+    if (m_free_handles.empty()) {
+        index = static_cast<uint32_t>(m_handles.size());
+        m_handles.emplace_back();
+    }
+    else {
+        index = m_free_handles.back();
+        m_free_handles.pop_back();
+    }
+
+    auto& target = m_emission_depth > 0 ? m_pending : m_slots;
+    auto& handle = m_handles[index];
+    handle.m_position = static_cast<uint32_t>(m_slots.size() + m_pending.size());
+    handle.m_used = true;
+    target.push_back(Slot{std::move(callback), client, index, true});
+
+    return {this, index, handle.m_generation};
 }
 
 //! Notify clients using given list of arguments.
 template <typename T, typename U>
 template <typename... Args>
-void SignalBase<T, U>::operator()(Args... args)
+void SignalBase<T, U>::operator()(const Args&... args)
 {
-    for (const auto& f : m_callbacks) {
-        f.first(args...);
+    // slots are neither added nor moved during the emission, references stay valid
+    const size_t count = m_slots.size();
+    EmissionGuard guard(this);
+    for (size_t index = 0; index < count; ++index) {
+        const auto& slot = m_slots[index];
+        if (slot.m_active)
+            slot.m_callback(args...);
     }
 }
 
+//! Disconnects single callback. Stale and invalid handles, as well as handles issued by other
+//! signals, are ignored.
+
+template <typename T, typename U> void SignalBase<T, U>::disconnect(SignalConnection connection)
+{
+    if (!isConnected(connection))
+        return;
+
+    if (auto slot = slot_at(m_handles[connection.m_index].m_position); slot)
+        deactivate(*slot);
+    cleanup();
+}
+
+//! Returns true if connection is alive.
+
+template <typename T, typename U>
+bool SignalBase<T, U>::isConnected(SignalConnection connection) const
+{
+    return connection.m_signal == this && connection.m_index < m_handles.size()
+           && m_handles[connection.m_index].m_used
+           && m_handles[connection.m_index].m_generation == connection.m_generation;
+}
+
 //! Remove client from the list to call back.
 
 template <typename T, typename U> void SignalBase<T, U>::remove_client(U client)
 {
-    m_callbacks.remove_if(
-        [client](const std::pair<T, U>& x) -> bool { return (x.second == client ? true : false); });
+    for (auto container : {&m_slots, &m_pending})
+        for (auto& slot : *container)
+            if (slot.m_active && slot.m_client == client)
+                deactivate(slot);
+    cleanup();
+}
+
+//! Returns number of active connections.
+
+template <typename T, typename U> size_t SignalBase<T, U>::size() const
+{
+    return m_slots.size() + m_pending.size() - m_inactive_count;
+}
+
+template <typename T, typename U>
+typename SignalBase<T, U>::Slot* SignalBase<T, U>::slot_at(uint32_t position)
+{
+    if (position < m_slots.size())
+        return &m_slots[position];
+    position -= static_cast<uint32_t>(m_slots.size());
+    return position < m_pending.size() ? &m_pending[position] : nullptr;
+}
+
+//! Marks slot as inactive and releases its handle. During the emission callback itself is
+//! destroyed later, since it might be running right now.
+
+template <typename T, typename U> void SignalBase<T, U>::deactivate(Slot& slot)
+{
+    slot.m_active = false;
+    ++m_inactive_count;
+    if (m_emission_depth > 0)
+        m_has_deferred_release = true;
+    else
+        slot.m_callback = T();
+
+    auto& handle = m_handles[slot.m_handle];
+    handle.m_used = false;
+    ++handle.m_generation;
+    m_free_handles.push_back(slot.m_handle);
+}
+
+//! Appends postponed connections and removes inactive slots, if no emission is in progress.
+
+template <typename T, typename U> void SignalBase<T, U>::cleanup()
+{
+    if (m_emission_depth > 0)
+        return;
+
+    if (!m_pending.empty()) {
+        std::move(m_pending.begin(), m_pending.end(), std::back_inserter(m_slots));
+        m_pending.clear();
+    }
+
+    if (m_has_deferred_release) {
+        for (auto& slot : m_slots)
+            if (!slot.m_active)
+                slot.m_callback = T();
+        m_has_deferred_release = false;
+    }
+
+    // compaction is deferred until inactive slots make a noticeable fraction
+    if (m_inactive_count == 0 || m_inactive_count * 4 < m_slots.size())
+        return;
+
+    size_t target{0};
+    for (size_t index = 0; index < m_slots.size(); ++index) {
+        if (!m_slots[index].m_active)
+            continue;
+        if (target != index)
+            m_slots[target] = std::move(m_slots[index]);
+        m_handles[m_slots[target].m_handle].m_position = static_cast<uint32_t>(target);
+        ++target;
+    }
+    m_slots.erase(m_slots.begin() + static_cast<std::ptrdiff_t>(target), m_slots.end());
+    m_inactive_count = 0;
 }
 
 //! Callback container for specific client type.
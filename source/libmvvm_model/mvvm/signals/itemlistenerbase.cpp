@@ -10,6 +10,7 @@
 #include "itemlistenerbase.h"
 #include "mvvm/model/sessionitem.h"
 #include "mvvm/signals/itemmapper.h"
+#include <algorithm>
 
 ModelView::ItemListenerBase::ItemListenerBase(ModelView::SessionItem* item)
 {
@@ -18,8 +19,7 @@ ModelView::ItemListenerBase::ItemListenerBase(ModelView::SessionItem* item)
 
 ModelView::ItemListenerBase::~ItemListenerBase()
 {
-    if (m_item)
-        m_item->mapper()->unsubscribe(this);
+    disconnect_all();
 }
 
 void ModelView::ItemListenerBase::setItem(ModelView::SessionItem* item)
@@ -36,32 +36,36 @@ void ModelView::ItemListenerBase::setItem(ModelView::SessionItem* item)
 
     auto on_item_destroy = [this](auto) {
         m_item = nullptr;
+        m_connections.clear();
         unsubscribe();
     };
-    m_item->mapper()->setOnItemDestroy(on_item_destroy, this);
+    keep(m_item->mapper()->setOnItemDestroy(on_item_destroy, this));
 
     subscribe();
 }
 
-void ModelView::ItemListenerBase::setOnItemDestroy(ModelView::Callbacks::item_t f)
+ModelView::SignalConnection
+ModelView::ItemListenerBase::setOnItemDestroy(ModelView::Callbacks::item_t f)
 {
-    item()->mapper()->setOnItemDestroy(f, this);
+    return keep(item()->mapper()->setOnItemDestroy(f, this));
 }
 
 //! Sets callback to be notified on item's data change.
 //! Callback will be called with (SessionItem*, data_role).
 
-void ModelView::ItemListenerBase::setOnDataChange(ModelView::Callbacks::item_int_t f)
+ModelView::SignalConnection
+ModelView::ItemListenerBase::setOnDataChange(ModelView::Callbacks::item_int_t f)
 {
-    item()->mapper()->setOnDataChange(f, this);
+    return keep(item()->mapper()->setOnDataChange(f, this));
 }
 
 //! Sets callback to be notified on item's property change.
 //! Callback will be called with (compound_item, property_name).
 
-void ModelView::ItemListenerBase::setOnPropertyChange(ModelView::Callbacks::item_str_t f)
+ModelView::SignalConnection
+ModelView::ItemListenerBase::setOnPropertyChange(ModelView::Callbacks::item_str_t f)
 {
-    item()->mapper()->setOnPropertyChange(f, this);
+    return keep(item()->mapper()->setOnPropertyChange(f, this));
 }
 
 //! Sets callback to be notified on item's children property change.
@@ -69,9 +73,10 @@ void ModelView::ItemListenerBase::setOnPropertyChange(ModelView::Callbacks::item
 //! layer with "thickness" property, the signal will be triggered on thickness change using
 //! (layeritem*, "thickness") as callback parameters.
 
-void ModelView::ItemListenerBase::setOnChildPropertyChange(ModelView::Callbacks::item_str_t f)
+ModelView::SignalConnection
+ModelView::ItemListenerBase::setOnChildPropertyChange(ModelView::Callbacks::item_str_t f)
 {
-    item()->mapper()->setOnChildPropertyChange(f, this);
+    return keep(item()->mapper()->setOnChildPropertyChange(f, this));
 }
 
 //! Sets callback to be notified on child insertion.
@@ -79,9 +84,10 @@ void ModelView::ItemListenerBase::setOnChildPropertyChange(ModelView::Callbacks:
 //! tag, the signal will be triggered on layer insertion with
 //! (multilayer*, {T_LAYER, row}) as callback parameters.
 
-void ModelView::ItemListenerBase::setOnItemInserted(ModelView::Callbacks::item_tagrow_t f)
+ModelView::SignalConnection
+ModelView::ItemListenerBase::setOnItemInserted(ModelView::Callbacks::item_tagrow_t f)
 {
-    item()->mapper()->setOnItemInserted(f, this);
+    return keep(item()->mapper()->setOnItemInserted(f, this));
 }
 
 //! Sets callback to be notified on child removal.
@@ -89,14 +95,16 @@ void ModelView::ItemListenerBase::setOnItemInserted(ModelView::Callbacks::item_t
 //! tag, the signal will be triggered on layer removal with
 //! (multilayer*, {T_LAYER, oldrow}) as callback parameters.
 
-void ModelView::ItemListenerBase::setOnItemRemoved(ModelView::Callbacks::item_tagrow_t f)
+ModelView::SignalConnection
+ModelView::ItemListenerBase::setOnItemRemoved(ModelView::Callbacks::item_tagrow_t f)
 {
-    item()->mapper()->setOnItemRemoved(f, this);
+    return keep(item()->mapper()->setOnItemRemoved(f, this));
 }
 
-void ModelView::ItemListenerBase::setOnAboutToRemoveItem(ModelView::Callbacks::item_tagrow_t f)
+ModelView::SignalConnection
+ModelView::ItemListenerBase::setOnAboutToRemoveItem(ModelView::Callbacks::item_tagrow_t f)
 {
-    item()->mapper()->setOnAboutToRemoveItem(f, this);
+    return keep(item()->mapper()->setOnAboutToRemoveItem(f, this));
 }
 
 //! Sets callback to be notified when row is about to be removed.
@@ -116,5 +124,36 @@ void ModelView::ItemListenerBase::unsubscribe_from_current()
 
     unsubscribe();
 
-    m_item->mapper()->unsubscribe(this);
+    disconnect_all();
+}
+
+//! Disconnects single callback using the handle returned on subscription.
+
+void ModelView::ItemListenerBase::disconnect(ModelView::SignalConnection connection)
+{
+    auto it = std::find(m_connections.begin(), m_connections.end(), connection);
+    if (it == m_connections.end())
+        return;
+
+    m_connections.erase(it);
+    if (m_item)
+        m_item->mapper()->disconnect(connection);
+}
+
+void ModelView::ItemListenerBase::disconnect_all()
+{
+    auto connections = std::move(m_connections);
+    m_connections.clear();
+    if (!m_item)
+        return;
+
+    for (auto connection : connections)
+        m_item->mapper()->disconnect(connection);
+}
+
+ModelView::SignalConnection
+ModelView::ItemListenerBase::keep(ModelView::SignalConnection connection)
+{
+    m_connections.push_back(connection);
+    return connection;
 }
@@ -12,6 +12,7 @@
 
 #include "mvvm/model_export.h"
 #include "mvvm/signals/callback_types.h"
+#include <vector>
 
 namespace ModelView {
 
@@ -33,13 +34,15 @@ public:
 
     void setItem(SessionItem* item);
 
-    void setOnItemDestroy(Callbacks::item_t f);
-    void setOnDataChange(Callbacks::item_int_t f);
-    void setOnPropertyChange(Callbacks::item_str_t f);
-    void setOnChildPropertyChange(Callbacks::item_str_t f);
-    void setOnItemInserted(Callbacks::item_tagrow_t f);
-    void setOnItemRemoved(Callbacks::item_tagrow_t f);
-    void setOnAboutToRemoveItem(Callbacks::item_tagrow_t f);
+    SignalConnection setOnItemDestroy(Callbacks::item_t f);
+    SignalConnection setOnDataChange(Callbacks::item_int_t f);
+    SignalConnection setOnPropertyChange(Callbacks::item_str_t f);
+    SignalConnection setOnChildPropertyChange(Callbacks::item_str_t f);
+    SignalConnection setOnItemInserted(Callbacks::item_tagrow_t f);
+    SignalConnection setOnItemRemoved(Callbacks::item_tagrow_t f);
+    SignalConnection setOnAboutToRemoveItem(Callbacks::item_tagrow_t f);
+
+    void disconnect(SignalConnection connection);
 
 protected:
     virtual void subscribe() {}   //! For necessary manipulations on new item.
@@ -48,7 +51,10 @@ protected:
 
 private:
     void unsubscribe_from_current();
+    void disconnect_all();
+    SignalConnection keep(SignalConnection connection);
     SessionItem* m_item{nullptr};
+    std::vector<SignalConnection> m_connections; //!< connections to the mapper of current item
 };
 
 } // namespace ModelView
@@ -11,6 +11,7 @@
 #include "mvvm/model/sessionitem.h"
 #include "mvvm/model/sessionmodel.h"
 #include "mvvm/signals/callbackcontainer.h"
+#include "mvvm/signals/modelmapper.h"
 #include <stdexcept>
 
 using namespace ModelView;
@@ -30,32 +31,28 @@ struct ItemMapper::ItemMapperImpl {
 
     ItemMapperImpl(ItemMapper* item_mapper) : m_itemMapper(item_mapper) {}
 
-    void unsubscribe(Callbacks::slot_t client)
+    //! Calls given function for every signal of the mapper.
+    template <typename F> void for_signals(F func)
     {
-        m_on_item_destroy.remove_client(client);
-        m_on_data_change.remove_client(client);
-        m_on_property_change.remove_client(client);
-        m_on_child_property_change.remove_client(client);
-        m_on_item_inserted.remove_client(client);
-        m_on_item_removed.remove_client(client);
-        m_on_about_to_remove_item.remove_client(client);
+        func(m_on_item_destroy);
+        func(m_on_data_change);
+        func(m_on_property_change);
+        func(m_on_child_property_change);
+        func(m_on_item_inserted);
+        func(m_on_item_removed);
+        func(m_on_about_to_remove_item);
     }
 
-    int nestlingDepth(SessionItem* item, int level = 0)
+    void unsubscribe(Callbacks::slot_t client)
     {
-        if (item == nullptr || item == m_itemMapper->model()->rootItem())
-            return -1;
-        if (item == m_item)
-            return level;
-        return nestlingDepth(item->parent(), level + 1);
+        for_signals([client](auto& signal) { signal.remove_client(client); });
     }
 
-    //! Processes signals from the model when item data changed.
+    //! Processes signals from the model when item data changed. Nestling is the distance
+    //! from our item to the changed item: 0 for the item itself, 1 for its property, etc.
 
-    void processDataChange(SessionItem* item, int role)
+    void processDataChange(SessionItem* item, int role, int nestling)
     {
-        int nestling = nestlingDepth(item);
-
         // own item data changed
         if (nestling == 0)
             callOnDataChange(item, role);
@@ -71,24 +68,6 @@ struct ItemMapper::ItemMapperImpl {
         }
     }
 
-    void processItemInserted(SessionItem* parent, const TagRow& tagrow)
-    {
-        if (parent == m_item)
-            callOnItemInserted(m_item, tagrow);
-    }
-
-    void processItemRemoved(SessionItem* parent, const TagRow& tagrow)
-    {
-        if (parent == m_item)
-            callOnItemRemoved(m_item, tagrow);
-    }
-
-    void processAboutToRemoveItem(SessionItem* parent, const TagRow& tagrow)
-    {
-        if (parent == m_item)
-            callOnAboutToRemoveItem(m_item, tagrow);
-    }
-
     //! Notifies all callbacks subscribed to "item data is changed" event.
 
     void callOnDataChange(SessionItem* item, int role)
@@ -149,60 +128,58 @@ ItemMapper::ItemMapper(SessionItem* item)
 
     p_impl->m_item = item;
 
-    auto on_data_change = [this](auto item, auto role) { p_impl->processDataChange(item, role); };
-    ModelListener::setOnDataChange(on_data_change);
-
-    auto on_item_inserted = [this](auto item, auto tagrow) {
-        p_impl->processItemInserted(item, tagrow);
-    };
-    ModelListener::setOnItemInserted(on_item_inserted, this);
-
-    auto on_item_removed = [this](auto item, auto tagrow) {
-        p_impl->processItemRemoved(item, tagrow);
-    };
-    ModelListener::setOnItemRemoved(on_item_removed, this);
+    // instead of listening to all model's changes, registering in per-item index of the mapper
+    model()->mapper()->registerItemMapper(this, item);
+}
 
-    auto on_about_to_remove_item = [this](auto item, auto tagrow) {
-        p_impl->processAboutToRemoveItem(item, tagrow);
-    };
-    ModelListener::setOnAboutToRemoveItem(on_about_to_remove_item, this);
+ItemMapper::~ItemMapper()
+{
+    if (model())
+        model()->mapper()->unregisterItemMapper(this, p_impl->m_item);
 }
 
-ItemMapper::~ItemMapper() = default;
+SignalConnection ItemMapper::setOnItemDestroy(Callbacks::item_t f, Callbacks::slot_t owner)
+{
+    return p_impl->m_on_item_destroy.connect(std::move(f), owner);
+}
 
-void ItemMapper::setOnItemDestroy(Callbacks::item_t f, Callbacks::slot_t owner)
+SignalConnection ItemMapper::setOnDataChange(Callbacks::item_int_t f, Callbacks::slot_t owner)
 {
-    p_impl->m_on_item_destroy.connect(std::move(f), owner);
+    return p_impl->m_on_data_change.connect(std::move(f), owner);
 }
 
-void ItemMapper::setOnDataChange(Callbacks::item_int_t f, Callbacks::slot_t owner)
+SignalConnection ItemMapper::setOnPropertyChange(Callbacks::item_str_t f, Callbacks::slot_t owner)
 {
-    p_impl->m_on_data_change.connect(std::move(f), owner);
+    return p_impl->m_on_property_change.connect(std::move(f), owner);
 }
 
-void ItemMapper::setOnPropertyChange(Callbacks::item_str_t f, Callbacks::slot_t owner)
+SignalConnection ItemMapper::setOnChildPropertyChange(Callbacks::item_str_t f,
+                                                      Callbacks::slot_t owner)
 {
-    p_impl->m_on_property_change.connect(std::move(f), owner);
+    return p_impl->m_on_child_property_change.connect(std::move(f), owner);
 }
 
-void ItemMapper::setOnChildPropertyChange(Callbacks::item_str_t f, Callbacks::slot_t owner)
+SignalConnection ItemMapper::setOnItemInserted(Callbacks::item_tagrow_t f, Callbacks::slot_t owner)
 {
-    p_impl->m_on_child_property_change.connect(std::move(f), owner);
+    return p_impl->m_on_item_inserted.connect(std::move(f), owner);
 }
 
-void ItemMapper::setOnItemInserted(Callbacks::item_tagrow_t f, Callbacks::slot_t owner)
+SignalConnection ItemMapper::setOnItemRemoved(Callbacks::item_tagrow_t f, Callbacks::slot_t owner)
 {
-    p_impl->m_on_item_inserted.connect(std::move(f), owner);
+    return p_impl->m_on_item_removed.connect(std::move(f), owner);
 }
 
-void ItemMapper::setOnItemRemoved(Callbacks::item_tagrow_t f, Callbacks::slot_t owner)
+SignalConnection ItemMapper::setOnAboutToRemoveItem(Callbacks::item_tagrow_t f,
+                                                    Callbacks::slot_t owner)
 {
-    p_impl->m_on_item_removed.connect(std::move(f), owner);
+    return p_impl->m_on_about_to_remove_item.connect(std::move(f), owner);
 }
 
-void ItemMapper::setOnAboutToRemoveItem(Callbacks::item_tagrow_t f, Callbacks::slot_t owner)
+//! Disconnects single callback using the handle returned on subscription.
+
+void ItemMapper::disconnect(SignalConnection connection)
 {
-    p_impl->m_on_about_to_remove_item.connect(std::move(f), owner);
+    p_impl->for_signals([connection](auto& signal) { signal.disconnect(connection); });
 }
 
 void ItemMapper::unsubscribe(Callbacks::slot_t client)
@@ -224,3 +201,26 @@ void ItemMapper::callOnItemDestroy()
     if (p_impl->m_active)
         p_impl->m_on_item_destroy(p_impl->m_item);
 }
+
+//! Processes signal from the model about data change in the item itself (nestling=0), in one of its
+//! children (nestling=1) or grandchildren (nestling=2).
+
+void ItemMapper::processDataChange(SessionItem* item, int role, int nestling)
+{
+    p_impl->processDataChange(item, role, nestling);
+}
+
+void ItemMapper::processItemInserted(const TagRow& tagrow)
+{
+    p_impl->callOnItemInserted(p_impl->m_item, tagrow);
+}
+
+void ItemMapper::processItemRemoved(const TagRow& tagrow)
+{
+    p_impl->callOnItemRemoved(p_impl->m_item, tagrow);
+}
+
+void ItemMapper::processAboutToRemoveItem(const TagRow& tagrow)
+{
+    p_impl->callOnAboutToRemoveItem(p_impl->m_item, tagrow);
+}
@@ -19,9 +19,8 @@ namespace ModelView {
 class SessionItem;
 
 //! Provides notifications on various changes for a specific item.
-//! ItemMapper listens signals coming from the model (i.e. via ModelMapper) and processes only whose
-//! signals which are related to the given item. Notifies all interested subscribers about things
-//! going with the item and its relatives.
+//! ItemMapper receives signals from the model (i.e. via ModelMapper) which are related to the given
+//! item. Notifies all interested subscribers about things going with the item and its relatives.
 
 class MVVM_MODEL_EXPORT ItemMapper : public ItemListenerInterface,
                                      private ModelListener<SessionModel> {
@@ -29,13 +28,18 @@ public:
     ItemMapper(SessionItem* item);
     ~ItemMapper();
 
-    void setOnItemDestroy(Callbacks::item_t f, Callbacks::slot_t owner) override;
-    void setOnDataChange(Callbacks::item_int_t f, Callbacks::slot_t owner) override;
-    void setOnPropertyChange(Callbacks::item_str_t f, Callbacks::slot_t owner) override;
-    void setOnChildPropertyChange(Callbacks::item_str_t f, Callbacks::slot_t owner) override;
-    void setOnItemInserted(Callbacks::item_tagrow_t f, Callbacks::slot_t owner) override;
-    void setOnItemRemoved(Callbacks::item_tagrow_t f, Callbacks::slot_t owner) override;
-    void setOnAboutToRemoveItem(Callbacks::item_tagrow_t f, Callbacks::slot_t owner) override;
+    SignalConnection setOnItemDestroy(Callbacks::item_t f, Callbacks::slot_t owner) override;
+    SignalConnection setOnDataChange(Callbacks::item_int_t f, Callbacks::slot_t owner) override;
+    SignalConnection setOnPropertyChange(Callbacks::item_str_t f, Callbacks::slot_t owner) override;
+    SignalConnection setOnChildPropertyChange(Callbacks::item_str_t f,
+                                              Callbacks::slot_t owner) override;
+    SignalConnection setOnItemInserted(Callbacks::item_tagrow_t f,
+                                       Callbacks::slot_t owner) override;
+    SignalConnection setOnItemRemoved(Callbacks::item_tagrow_t f, Callbacks::slot_t owner) override;
+    SignalConnection setOnAboutToRemoveItem(Callbacks::item_tagrow_t f,
+                                            Callbacks::slot_t owner) override;
+
+    void disconnect(SignalConnection connection) override;
 
     void unsubscribe(Callbacks::slot_t client) override;
 
@@ -43,7 +47,12 @@ public:
 
 private:
     friend class SessionItem;
+    friend class ModelMapper;
     void callOnItemDestroy();
+    void processDataChange(SessionItem* item, int role, int nestling);
+    void processItemInserted(const TagRow& tagrow);
+    void processItemRemoved(const TagRow& tagrow);
+    void processAboutToRemoveItem(const TagRow& tagrow);
 
     struct ItemMapperImpl;
     std::unique_ptr<ItemMapperImpl> p_impl;
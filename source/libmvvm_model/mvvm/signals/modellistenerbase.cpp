@@ -10,6 +10,7 @@
 #include "mvvm/signals/modellistenerbase.h"
 #include "mvvm/model/sessionmodel.h"
 #include "mvvm/signals/modelmapper.h"
+#include <algorithm>
 #include <stdexcept>
 
 using namespace ModelView;
@@ -29,59 +30,122 @@ ModelListenerBase::~ModelListenerBase()
 //! Sets callback to be notified on item's data change. The callback will be called
 //! with (SessionItem*, data_role).
 
-void ModelListenerBase::setOnDataChange(ModelView::Callbacks::item_int_t f, Callbacks::slot_t)
+SignalConnection ModelListenerBase::setOnDataChange(ModelView::Callbacks::item_int_t f,
+                                                    Callbacks::slot_t)
 {
-    m_model->mapper()->setOnDataChange(f, this);
+    return keep(m_model->mapper()->setOnDataChange(f, this));
 }
 
 //! Sets callback to be notified on item insert. The callback will be called with
 //! (SessionItem* parent, tagrow), where 'tagrow' denotes inserted child position.
 
-void ModelListenerBase::setOnItemInserted(ModelView::Callbacks::item_tagrow_t f, Callbacks::slot_t)
+SignalConnection ModelListenerBase::setOnItemInserted(ModelView::Callbacks::item_tagrow_t f,
+                                                      Callbacks::slot_t)
 {
-    m_model->mapper()->setOnItemInserted(f, this);
+    return keep(m_model->mapper()->setOnItemInserted(f, this));
 }
 
 //! Sets callback to be notified on item remove. The callback will be called with
 //! (SessionItem* parent, tagrow), where 'tagrow' denotes child position before the removal.
 
-void ModelListenerBase::setOnItemRemoved(ModelView::Callbacks::item_tagrow_t f, Callbacks::slot_t)
+SignalConnection ModelListenerBase::setOnItemRemoved(ModelView::Callbacks::item_tagrow_t f,
+                                                     Callbacks::slot_t)
 {
-    m_model->mapper()->setOnItemRemoved(f, this);
+    return keep(m_model->mapper()->setOnItemRemoved(f, this));
 }
 
 //! Sets callback to be notified when the item is about to be removed. The callback will be called
 //! with (SessionItem* parent, tagrow), where 'tagrow' denotes child position being removed.
 
-void ModelListenerBase::setOnAboutToRemoveItem(ModelView::Callbacks::item_tagrow_t f,
+SignalConnection ModelListenerBase::setOnAboutToRemoveItem(ModelView::Callbacks::item_tagrow_t f,
                                                Callbacks::slot_t)
 {
-    m_model->mapper()->setOnAboutToRemoveItem(f, this);
+    return keep(m_model->mapper()->setOnAboutToRemoveItem(f, this));
+}
+
+//! Sets callback to be notified on insert of the range of items. The callback will be called
+//! with (SessionItem* parent, tagrow, count), where 'tagrow' denotes first inserted child position.
+
+SignalConnection ModelListenerBase::setOnItemsInserted(Callbacks::item_range_t f, Callbacks::slot_t)
+{
+    return keep(m_model->mapper()->setOnItemsInserted(f, this));
+}
+
+//! Sets callback to be notified on removal of the range of items. The callback will be called
+//! with (SessionItem* parent, tagrow, count), where 'tagrow' denotes first removed child position.
+
+SignalConnection ModelListenerBase::setOnItemsRemoved(Callbacks::item_range_t f, Callbacks::slot_t)
+{
+    return keep(m_model->mapper()->setOnItemsRemoved(f, this));
+}
+
+//! Sets callback to be notified when the range of items is about to be removed. The callback will
+//! be called with (SessionItem* parent, tagrow, count), where 'tagrow' denotes first child position.
+
+SignalConnection ModelListenerBase::setOnAboutToRemoveItems(Callbacks::item_range_t f,
+                                                            Callbacks::slot_t)
+{
+    return keep(m_model->mapper()->setOnAboutToRemoveItems(f, this));
+}
+
+//! Sets the callback to be notified when the outermost batch of changes is finished.
+
+SignalConnection ModelListenerBase::setOnBatchFinished(Callbacks::model_t f, Callbacks::slot_t)
+{
+    return keep(m_model->mapper()->setOnBatchFinished(f, this));
 }
 
 //! Sets the callback for notifications on model destruction.
 
-void ModelListenerBase::setOnModelDestroyed(Callbacks::model_t f, Callbacks::slot_t)
+SignalConnection ModelListenerBase::setOnModelDestroyed(Callbacks::model_t f, Callbacks::slot_t)
 {
-    m_model->mapper()->setOnModelDestroyed(f, this);
+    return keep(m_model->mapper()->setOnModelDestroyed(f, this));
 }
 
 //! Sets the callback to be notified before model's full reset (root item recreated).
 
-void ModelListenerBase::setOnModelAboutToBeReset(Callbacks::model_t f, Callbacks::slot_t)
+SignalConnection ModelListenerBase::setOnModelAboutToBeReset(Callbacks::model_t f,
+                                                             Callbacks::slot_t)
 {
-    m_model->mapper()->setOnModelAboutToBeReset(f, this);
+    return keep(m_model->mapper()->setOnModelAboutToBeReset(f, this));
 }
 
 //! Sets the callback to be notified after model was fully reset (root item recreated).
 
-void ModelListenerBase::setOnModelReset(ModelView::Callbacks::model_t f, Callbacks::slot_t)
+SignalConnection ModelListenerBase::setOnModelReset(ModelView::Callbacks::model_t f,
+                                                    Callbacks::slot_t)
 {
-    m_model->mapper()->setOnModelReset(f, this);
+    return keep(m_model->mapper()->setOnModelReset(f, this));
 }
 
-void ModelListenerBase::unsubscribe(Callbacks::slot_t)
+//! Disconnects single callback using the handle returned on subscription.
+
+void ModelListenerBase::disconnect(SignalConnection connection)
 {
+    auto it = std::find(m_connections.begin(), m_connections.end(), connection);
+    if (it == m_connections.end())
+        return;
+
+    m_connections.erase(it);
     if (m_model)
-        m_model->mapper()->unsubscribe(this);
+        m_model->mapper()->disconnect(connection);
+}
+
+//! Disconnects all callbacks set via this listener.
+
+void ModelListenerBase::unsubscribe(Callbacks::slot_t)
+{
+    auto connections = std::move(m_connections);
+    m_connections.clear();
+    if (!m_model)
+        return;
+
+    for (auto connection : connections)
+        m_model->mapper()->disconnect(connection);
+}
+
+SignalConnection ModelListenerBase::keep(SignalConnection connection)
+{
+    m_connections.push_back(connection);
+    return connection;
 }
@@ -11,6 +11,7 @@
 #define MVVM_SIGNALS_MODELLISTENERBASE_H
 
 #include "mvvm/interfaces/modellistenerinterface.h"
+#include <vector>
 
 namespace ModelView {
 
@@ -20,6 +21,9 @@ class SessionModel;
 //! Automatically tracks the time of life of SessionModel. Unsubscribes from the model on
 //! own destruction.
 
+//! Handles of all connections are kept, so unsubscription disconnects them one by one, without
+//! looking through all callbacks of the model.
+
 class MVVM_MODEL_EXPORT ModelListenerBase : public ModelListenerInterface {
 public:
     ModelListenerBase(SessionModel* model);
@@ -27,18 +31,38 @@ public:
 
     // 'client' is not used here, since 'this' is used
 
-    void setOnDataChange(Callbacks::item_int_t f, Callbacks::slot_t client = {}) override;
-    void setOnItemInserted(Callbacks::item_tagrow_t f, Callbacks::slot_t client = {}) override;
-    void setOnItemRemoved(Callbacks::item_tagrow_t f, Callbacks::slot_t client = {}) override;
-    void setOnAboutToRemoveItem(Callbacks::item_tagrow_t f, Callbacks::slot_t client = {}) override;
-    void setOnModelDestroyed(Callbacks::model_t f, Callbacks::slot_t client = {}) override;
-    void setOnModelAboutToBeReset(Callbacks::model_t f, Callbacks::slot_t client = {}) override;
-    void setOnModelReset(Callbacks::model_t f, Callbacks::slot_t client = {}) override;
+    SignalConnection setOnDataChange(Callbacks::item_int_t f,
+                                     Callbacks::slot_t client = {}) override;
+    SignalConnection setOnItemInserted(Callbacks::item_tagrow_t f,
+                                       Callbacks::slot_t client = {}) override;
+    SignalConnection setOnItemRemoved(Callbacks::item_tagrow_t f,
+                                      Callbacks::slot_t client = {}) override;
+    SignalConnection setOnAboutToRemoveItem(Callbacks::item_tagrow_t f,
+                                            Callbacks::slot_t client = {}) override;
+    SignalConnection setOnItemsInserted(Callbacks::item_range_t f,
+                                        Callbacks::slot_t client = {}) override;
+    SignalConnection setOnItemsRemoved(Callbacks::item_range_t f,
+                                       Callbacks::slot_t client = {}) override;
+    SignalConnection setOnAboutToRemoveItems(Callbacks::item_range_t f,
+                                             Callbacks::slot_t client = {}) override;
+    SignalConnection setOnBatchFinished(Callbacks::model_t f,
+                                        Callbacks::slot_t client = {}) override;
+    SignalConnection setOnModelDestroyed(Callbacks::model_t f,
+                                         Callbacks::slot_t client = {}) override;
+    SignalConnection setOnModelAboutToBeReset(Callbacks::model_t f,
+                                              Callbacks::slot_t client = {}) override;
+    SignalConnection setOnModelReset(Callbacks::model_t f, Callbacks::slot_t client = {}) override;
+
+    void disconnect(SignalConnection connection) override;
 
     void unsubscribe(Callbacks::slot_t client = {}) override;
 
 protected:
     SessionModel* m_model{nullptr};
+
+private:
+    SignalConnection keep(SignalConnection connection);
+    std::vector<SignalConnection> m_connections;
 };
 
 } // namespace ModelView
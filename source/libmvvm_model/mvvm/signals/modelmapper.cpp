@@ -8,33 +8,255 @@
 // ************************************************************************** //
 
 #include "mvvm/signals/modelmapper.h"
+#include "mvvm/model/sessionitem.h"
+#include "mvvm/model/sessionitemtags.h"
+#include "mvvm/model/sessionmodel.h"
 #include "mvvm/signals/callbackcontainer.h"
+#include "mvvm/signals/itemmapper.h"
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
 
 using namespace ModelView;
 
 struct ModelMapper::ModelMapperImpl {
+    //! Range of children inserted into (removed from) the same parent during the batch.
+    struct PendingRange {
+        bool m_insert{true};
+        SessionItem* m_parent{nullptr};
+        std::string m_tag;
+        int m_row{0};
+        int m_count{0}; //!< zero count means no pending range
+    };
+
     Signal<Callbacks::item_int_t> m_on_data_change;
     Signal<Callbacks::item_tagrow_t> m_on_item_inserted;
     Signal<Callbacks::item_tagrow_t> m_on_item_removed;
     Signal<Callbacks::item_tagrow_t> m_on_item_about_removed;
+    Signal<Callbacks::item_range_t> m_on_items_inserted;
+    Signal<Callbacks::item_range_t> m_on_items_removed;
+    Signal<Callbacks::item_range_t> m_on_items_about_removed;
+    Signal<Callbacks::model_t> m_on_batch_finished;
     Signal<Callbacks::model_t> m_on_model_destroyed;
     Signal<Callbacks::model_t> m_on_model_about_reset;
     Signal<Callbacks::model_t> m_on_model_reset;
 
     bool m_active{true};
     SessionModel* m_model{nullptr};
+    std::unordered_map<const SessionItem*, std::vector<ItemMapper*>> m_item_mappers;
+
+    int m_batch_depth{0};
+    PendingRange m_range;
+    PendingRange m_announced_removal; //!< rest of the range announced as about to be removed
+    std::vector<SessionItem*> m_changed_items; //!< items with pending data change, in order
+    size_t m_next_changed{0};                   //!< next item in m_changed_items to deliver
+    std::unordered_map<const SessionItem*, std::vector<int>> m_changed_roles;
+    const SessionItem* m_delivered_item{nullptr}; //!< item whose data change is being delivered
+    bool m_delivered_item_removed{false};
 
     ModelMapperImpl(SessionModel* model) : m_model(model){};
 
+    //! Calls given function for all item mappers of the item. Mappers can be added or removed
+    //! by the function itself.
+    template <typename F> void for_item_mappers(const SessionItem* item, F func)
+    {
+        for (size_t index = 0;; ++index) {
+            auto it = m_item_mappers.find(item);
+            if (it == m_item_mappers.end() || index >= it->second.size())
+                return;
+            func(it->second[index]);
+        }
+    }
+
+    //! Notifies mappers of the item, its parent and grandparent about item's data change.
+    void notify_item_mappers(SessionItem* item, int role)
+    {
+        if (m_item_mappers.empty())
+            return;
+
+        // item, its parent and grandparent; root item is never notified
+        SessionItem* relatives[] = {item, nullptr, nullptr};
+        for (int level = 1; level < 3 && relatives[level - 1]; ++level)
+            relatives[level] = relatives[level - 1]->parent();
+
+        for (int level = 0; level < 3; ++level) {
+            auto relative = relatives[level];
+            if (!relative || relative == m_model->rootItem())
+                return;
+            for_item_mappers(relative, [item, role, level](ItemMapper* mapper) {
+                mapper->processDataChange(item, role, level);
+            });
+        }
+    }
+
+    void emit_data_change(SessionItem* item, int role)
+    {
+        m_on_data_change(item, role);
+        notify_item_mappers(item, role);
+    }
+
+    //! Notifies about insertion of children occupying rows [tagrow.row, tagrow.row + count).
+    //! Listeners of single insertions are notified in ascending order of rows.
+    void emit_inserted(SessionItem* parent, const TagRow& tagrow, int count)
+    {
+        for (int index = 0; index < count; ++index) {
+            TagRow child_tagrow{tagrow.tag, tagrow.row + index};
+            m_on_item_inserted(parent, child_tagrow);
+            for_item_mappers(parent, [&child_tagrow](ItemMapper* mapper) {
+                mapper->processItemInserted(child_tagrow);
+            });
+        }
+        m_on_items_inserted(parent, tagrow, count);
+    }
+
+    //! Notifies about removal of children which were occupying rows [tagrow.row, tagrow.row +
+    //! count). Listeners of single removals are notified 'count' times about the first row.
+    void emit_removed(SessionItem* parent, const TagRow& tagrow, int count)
+    {
+        for (int index = 0; index < count; ++index) {
+            m_on_item_removed(parent, tagrow);
+            for_item_mappers(parent,
+                             [&tagrow](ItemMapper* mapper) { mapper->processItemRemoved(tagrow); });
+        }
+        m_on_items_removed(parent, tagrow, count);
+    }
+
+    void record_data_change(SessionItem* item, int role)
+    {
+        auto& roles = m_changed_roles[item];
+        if (roles.empty())
+            m_changed_items.push_back(item);
+        if (std::find(roles.begin(), roles.end(), role) == roles.end())
+            roles.push_back(role);
+    }
+
+    //! Returns true if insertion of the child at given position extends pending range.
+    bool extends_insert_range(const SessionItem* parent, const TagRow& tagrow) const
+    {
+        return m_range.m_count > 0 && m_range.m_insert && m_range.m_parent == parent
+               && m_range.m_tag == tagrow.tag && tagrow.row >= m_range.m_row
+               && tagrow.row <= m_range.m_row + m_range.m_count;
+    }
+
+    //! Returns true if removal of the child at given position extends pending range.
+    bool extends_remove_range(const SessionItem* parent, const TagRow& tagrow) const
+    {
+        return m_range.m_count > 0 && !m_range.m_insert && m_range.m_parent == parent
+               && m_range.m_tag == tagrow.tag
+               && (tagrow.row == m_range.m_row || tagrow.row + 1 == m_range.m_row);
+    }
+
+    void record_range(bool insert, SessionItem* parent, const TagRow& tagrow)
+    {
+        if (insert ? extends_insert_range(parent, tagrow) : extends_remove_range(parent, tagrow)) {
+            m_range.m_row = std::min(m_range.m_row, tagrow.row);
+            ++m_range.m_count;
+            return;
+        }
+        flush_range();
+        m_range = {insert, parent, tagrow.tag, tagrow.row, 1};
+    }
+
+    //! Delivers pending range of inserted (removed) children.
+    void flush_range()
+    {
+        if (m_range.m_count == 0)
+            return;
+        auto range = std::move(m_range);
+        m_range = {};
+        if (range.m_insert)
+            emit_inserted(range.m_parent, TagRow{range.m_tag, range.m_row}, range.m_count);
+        else
+            emit_removed(range.m_parent, TagRow{range.m_tag, range.m_row}, range.m_count);
+    }
+
+    //! Delivers pending data changes. Changes caused by callbacks are delivered too.
+    void flush_data_changes()
+    {
+        while (m_next_changed < m_changed_items.size()) {
+            auto item = m_changed_items[m_next_changed++];
+            auto it = m_changed_roles.find(item);
+            if (it == m_changed_roles.end())
+                continue; // item was removed from the model
+            auto roles = std::move(it->second);
+            m_changed_roles.erase(it);
+
+            m_delivered_item = item;
+            m_delivered_item_removed = false;
+            for (auto role : roles) {
+                emit_data_change(item, role);
+                if (m_delivered_item_removed)
+                    break;
+            }
+            m_delivered_item = nullptr;
+        }
+        m_changed_items.clear();
+        m_next_changed = 0;
+    }
+
+    void flush()
+    {
+        while (m_range.m_count > 0 || !m_changed_roles.empty()) {
+            flush_range();
+            flush_data_changes();
+        }
+    }
+
+    //! Drops pending data changes of the given item and all its descendants.
+    void forget_data_changes(const SessionItem* item)
+    {
+        if (m_changed_roles.empty() && !m_delivered_item)
+            return;
+
+        std::vector<const SessionItem*> stack = {item};
+        while (!stack.empty()) {
+            auto current = stack.back();
+            stack.pop_back();
+            m_changed_roles.erase(current);
+            if (current == m_delivered_item)
+                m_delivered_item_removed = true;
+            for (auto child : current->childrenRange())
+                stack.push_back(child);
+        }
+    }
+
+    void clear_pending()
+    {
+        m_range = {};
+        m_announced_removal = {};
+        m_changed_items.clear();
+        m_changed_roles.clear();
+        m_next_changed = 0;
+    }
+
+    //! Closes the outermost batch without delivering notifications collected so far.
+    void drop_batch()
+    {
+        m_delivered_item = nullptr;
+        clear_pending();
+        m_batch_depth = 0;
+    }
+
+    //! Calls given function for every signal of the mapper.
+    template <typename F> void for_signals(F func)
+    {
+        func(m_on_data_change);
+        func(m_on_item_inserted);
+        func(m_on_item_removed);
+        func(m_on_item_about_removed);
+        func(m_on_items_inserted);
+        func(m_on_items_removed);
+        func(m_on_items_about_removed);
+        func(m_on_batch_finished);
+        func(m_on_model_destroyed);
+        func(m_on_model_about_reset);
+        func(m_on_model_reset);
+    }
+
     void unsubscribe(Callbacks::slot_t client)
     {
-        m_on_data_change.remove_client(client);
-        m_on_item_inserted.remove_client(client);
-        m_on_item_removed.remove_client(client);
-        m_on_item_about_removed.remove_client(client);
-        m_on_model_destroyed.remove_client(client);
-        m_on_model_about_reset.remove_client(client);
-        m_on_model_reset.remove_client(client);
+        for_signals([client](auto& signal) { signal.remove_client(client); });
     }
 };
 
@@ -45,54 +267,90 @@ ModelMapper::~ModelMapper() = default;
 //! Sets callback to be notified on item's data change. The callback will be called
 //! with (SessionItem*, data_role).
 
-void ModelMapper::setOnDataChange(Callbacks::item_int_t f, Callbacks::slot_t client)
+SignalConnection ModelMapper::setOnDataChange(Callbacks::item_int_t f, Callbacks::slot_t client)
 {
-    p_impl->m_on_data_change.connect(std::move(f), client);
+    return p_impl->m_on_data_change.connect(std::move(f), client);
 }
 
 //! Sets callback to be notified on item insert. The callback will be called with
 //! (SessionItem* parent, tagrow), where 'tagrow' denotes inserted child position.
 
-void ModelMapper::setOnItemInserted(Callbacks::item_tagrow_t f, Callbacks::slot_t client)
+SignalConnection ModelMapper::setOnItemInserted(Callbacks::item_tagrow_t f,
+                                                Callbacks::slot_t client)
 {
-    p_impl->m_on_item_inserted.connect(std::move(f), client);
+    return p_impl->m_on_item_inserted.connect(std::move(f), client);
 }
 
 //! Sets callback to be notified on item remove. The callback will be called with
 //! (SessionItem* parent, tagrow), where 'tagrow' denotes child position before the removal.
 
-void ModelMapper::setOnItemRemoved(Callbacks::item_tagrow_t f, Callbacks::slot_t client)
+SignalConnection ModelMapper::setOnItemRemoved(Callbacks::item_tagrow_t f, Callbacks::slot_t client)
 {
-    p_impl->m_on_item_removed.connect(std::move(f), client);
+    return p_impl->m_on_item_removed.connect(std::move(f), client);
 }
 
 //! Sets callback to be notified when the item is about to be removed. The callback will be called
 //! with (SessionItem* parent, tagrow), where 'tagrow' denotes child position being removed.
 
-void ModelMapper::setOnAboutToRemoveItem(Callbacks::item_tagrow_t f, Callbacks::slot_t client)
+SignalConnection ModelMapper::setOnAboutToRemoveItem(Callbacks::item_tagrow_t f,
+                                                     Callbacks::slot_t client)
+{
+    return p_impl->m_on_item_about_removed.connect(std::move(f), client);
+}
+
+//! Sets callback to be notified on insert of the range of items. The callback will be called
+//! with (SessionItem* parent, tagrow, count), where 'tagrow' denotes first inserted child position.
+
+SignalConnection ModelMapper::setOnItemsInserted(Callbacks::item_range_t f,
+                                                 Callbacks::slot_t client)
+{
+    return p_impl->m_on_items_inserted.connect(std::move(f), client);
+}
+
+//! Sets callback to be notified on removal of the range of items. The callback will be called
+//! with (SessionItem* parent, tagrow, count), where 'tagrow' denotes first removed child position.
+
+SignalConnection ModelMapper::setOnItemsRemoved(Callbacks::item_range_t f, Callbacks::slot_t client)
+{
+    return p_impl->m_on_items_removed.connect(std::move(f), client);
+}
+
+//! Sets callback to be notified when the range of items is about to be removed. The callback will
+//! be called with (SessionItem* parent, tagrow, count), where 'tagrow' denotes first child position.
+
+SignalConnection ModelMapper::setOnAboutToRemoveItems(Callbacks::item_range_t f,
+                                                      Callbacks::slot_t client)
 {
-    p_impl->m_on_item_about_removed.connect(std::move(f), client);
+    return p_impl->m_on_items_about_removed.connect(std::move(f), client);
+}
+
+//! Sets the callback to be notified when the outermost batch of changes is finished.
+
+SignalConnection ModelMapper::setOnBatchFinished(Callbacks::model_t f, Callbacks::slot_t client)
+{
+    return p_impl->m_on_batch_finished.connect(std::move(f), client);
 }
 
 //! Sets the callback for notifications on model destruction.
 
-void ModelMapper::setOnModelDestroyed(Callbacks::model_t f, Callbacks::slot_t client)
+SignalConnection ModelMapper::setOnModelDestroyed(Callbacks::model_t f, Callbacks::slot_t client)
 {
-    p_impl->m_on_model_destroyed.connect(std::move(f), client);
+    return p_impl->m_on_model_destroyed.connect(std::move(f), client);
 }
 
 //! Sets the callback to be notified just before the reset of the root item.
 
-void ModelMapper::setOnModelAboutToBeReset(Callbacks::model_t f, Callbacks::slot_t client)
+SignalConnection ModelMapper::setOnModelAboutToBeReset(Callbacks::model_t f,
+                                                       Callbacks::slot_t client)
 {
-    p_impl->m_on_model_about_reset.connect(std::move(f), client);
+    return p_impl->m_on_model_about_reset.connect(std::move(f), client);
 }
 
 //! Sets the callback to be notified right after the root item recreation.
 
-void ModelMapper::setOnModelReset(Callbacks::model_t f, Callbacks::slot_t client)
+SignalConnection ModelMapper::setOnModelReset(Callbacks::model_t f, Callbacks::slot_t client)
 {
-    p_impl->m_on_model_reset.connect(std::move(f), client);
+    return p_impl->m_on_model_reset.connect(std::move(f), client);
 }
 
 //! Sets activity flag to given value. Will disable all callbacks if false.
@@ -102,6 +360,62 @@ void ModelMapper::setActive(bool value)
     p_impl->m_active = value;
 }
 
+//! Starts the batch of changes. Batches can be nested, notifications are delivered when the
+//! outermost batch ends.
+
+void ModelMapper::beginBatch()
+{
+    ++p_impl->m_batch_depth;
+}
+
+//! Ends the batch of changes. Delivers collected notifications if it was the outermost batch.
+//! If a callback throws, the batch is closed anyway and undelivered notifications are dropped.
+
+void ModelMapper::endBatch()
+{
+    if (p_impl->m_batch_depth == 0)
+        throw std::runtime_error("ModelMapper::endBatch() -> No batch was started.");
+
+    if (p_impl->m_batch_depth == 1) {
+        try {
+            p_impl->flush(); // batch stays open, so changes made by callbacks are collected too
+        }
+        catch (...) {
+            p_impl->drop_batch();
+            throw;
+        }
+    }
+
+    if (--p_impl->m_batch_depth == 0)
+        p_impl->m_on_batch_finished(p_impl->m_model);
+}
+
+//! Ends the batch of changes without delivering notifications. Notifications collected by the
+//! outermost batch are dropped, those of a nested batch stay with the enclosing one.
+
+void ModelMapper::abortBatch()
+{
+    if (p_impl->m_batch_depth > 1)
+        --p_impl->m_batch_depth;
+    else
+        p_impl->drop_batch();
+}
+
+//! Returns true if notifications are collected in the batch.
+
+bool ModelMapper::isBatching() const
+{
+    return p_impl->m_batch_depth > 0;
+}
+
+//! Disconnects single callback using the handle returned on subscription.
+
+void ModelMapper::disconnect(SignalConnection connection)
+{
+    // signals ignore handles issued by others
+    p_impl->for_signals([connection](auto& signal) { signal.disconnect(connection); });
+}
+
 //! Removes given client from all subscriptions.
 
 void ModelMapper::unsubscribe(Callbacks::slot_t client)
@@ -109,41 +423,138 @@ void ModelMapper::unsubscribe(Callbacks::slot_t client)
     p_impl->unsubscribe(client);
 }
 
+//! Adds item mapper to the index of the given item.
+
+void ModelMapper::registerItemMapper(ItemMapper* mapper, const SessionItem* item)
+{
+    p_impl->m_item_mappers[item].push_back(mapper);
+}
+
+//! Removes item mapper from the index of the given item.
+
+void ModelMapper::unregisterItemMapper(ItemMapper* mapper, const SessionItem* item)
+{
+    auto it = p_impl->m_item_mappers.find(item);
+    if (it == p_impl->m_item_mappers.end())
+        return;
+
+    auto& mappers = it->second;
+    mappers.erase(std::remove(mappers.begin(), mappers.end(), mapper), mappers.end());
+    if (mappers.empty())
+        p_impl->m_item_mappers.erase(it);
+}
+
 //! Notifies all callbacks subscribed to "item data is changed" event.
 
 void ModelMapper::callOnDataChange(SessionItem* item, int role)
 {
-    if (p_impl->m_active)
-        p_impl->m_on_data_change(item, role);
+    if (!p_impl->m_active)
+        return;
+
+    if (isBatching())
+        p_impl->record_data_change(item, role);
+    else
+        p_impl->emit_data_change(item, role);
 }
 
-//! Notifies all callbacks subscribed to "item data is changed" event.
+//! Prepares for insertion of the child into given parent. Delivers pending range of children, if
+//! the insertion doesn't extend it, so listeners see the model in the consistent state.
+
+void ModelMapper::prepareItemInsert(SessionItem* parent, const TagRow& tagrow)
+{
+    if (!p_impl->m_active || p_impl->m_range.m_count == 0)
+        return;
+
+    if (p_impl->m_range.m_insert && p_impl->m_range.m_parent == parent) {
+        auto tags = parent->itemTags();
+        auto tag = tagrow.tag.empty() ? tags->defaultTag() : tagrow.tag;
+        auto row = tagrow.row < 0 ? tags->itemCount(tag) : tagrow.row;
+        if (p_impl->extends_insert_range(parent, TagRow{tag, row}))
+            return;
+    }
+    p_impl->flush_range();
+}
+
+//! Notifies all callbacks subscribed to "item is inserted" event.
 
 void ModelMapper::callOnItemInserted(SessionItem* parent, const TagRow& tagrow)
 {
-    if (p_impl->m_active)
-        p_impl->m_on_item_inserted(parent, tagrow);
+    if (!p_impl->m_active)
+        return;
+
+    if (isBatching())
+        p_impl->record_range(true, parent, tagrow);
+    else
+        p_impl->emit_inserted(parent, tagrow, 1);
 }
 
+//! Notifies all callbacks subscribed to "item is removed" event.
+
 void ModelMapper::callOnItemRemoved(SessionItem* parent, const TagRow& tagrow)
 {
-    if (p_impl->m_active)
-        p_impl->m_on_item_removed(parent, tagrow);
+    if (!p_impl->m_active)
+        return;
+
+    if (isBatching())
+        p_impl->record_range(false, parent, tagrow);
+    else
+        p_impl->emit_removed(parent, tagrow, 1);
 }
 
+//! Notifies all callbacks subscribed to "item is about to be removed" event. This notification is
+//! never postponed. Pending insertions are delivered first.
+
 void ModelMapper::callOnItemAboutToBeRemoved(SessionItem* parent, const TagRow& tagrow)
 {
-    if (p_impl->m_active)
-        p_impl->m_on_item_about_removed(parent, tagrow);
+    p_impl->forget_data_changes(parent->getItem(tagrow.tag, tagrow.row));
+
+    if (!p_impl->m_active)
+        return;
+
+    if (isBatching() && !p_impl->extends_remove_range(parent, tagrow))
+        p_impl->flush_range();
+
+    p_impl->m_on_item_about_removed(parent, tagrow);
+    p_impl->for_item_mappers(
+        parent, [&tagrow](ItemMapper* mapper) { mapper->processAboutToRemoveItem(tagrow); });
+
+    // removal of the first or the last child of already announced range is not reported to range
+    // listeners again
+    auto& announced = p_impl->m_announced_removal;
+    if (announced.m_count > 0 && announced.m_parent == parent && announced.m_tag == tagrow.tag
+        && (tagrow.row == announced.m_row || tagrow.row == announced.m_row + announced.m_count - 1))
+        --announced.m_count;
+    else
+        p_impl->m_on_items_about_removed(parent, tagrow, 1);
+}
+
+//! Notifies callbacks subscribed to "items are about to be removed" event about removal of children
+//! occupying rows [tagrow.row, tagrow.row + count). Children are expected to be removed right
+//! after, one by one, starting either from the first or from the last row of the range.
+
+void ModelMapper::callOnItemsAboutToBeRemoved(SessionItem* parent, const TagRow& tagrow, int count)
+{
+    if (!p_impl->m_active)
+        return;
+
+    if (isBatching() && !p_impl->extends_remove_range(parent, tagrow))
+        p_impl->flush_range();
+
+    p_impl->m_announced_removal = {false, parent, tagrow.tag, tagrow.row, count};
+    p_impl->m_on_items_about_removed(parent, tagrow, count);
 }
 
 void ModelMapper::callOnModelDestroyed()
 {
+    p_impl->clear_pending();
     p_impl->m_on_model_destroyed(p_impl->m_model);
 }
 
+//! Notifies about coming reset of the model. Pending notifications are delivered first.
+
 void ModelMapper::callOnModelAboutToBeReset()
 {
+    p_impl->flush();
     p_impl->m_on_model_about_reset(p_impl->m_model);
 }
 
@@ -17,10 +17,21 @@ namespace ModelView {
 
 class SessionItem;
 class SessionModel;
+class ItemMapper;
 
 //! Provides notifications on various SessionModel changes.
 //! Allows to subscribe to SessionModel's changes, and triggers notifications.
 
+//! Notifications can be grouped using beginBatch()/endBatch(). Inside the batch data changes are
+//! coalesced per (item, role), and adjacent insertions (removals) of children are merged into
+//! ranges. Collected notifications are delivered when the outermost batch ends, or earlier, when
+//! the order of events requires it (i.e. pending insertions are delivered before the next
+//! removal). "About to remove" notifications are never postponed.
+
+//! ItemMapper's are not subscribed to model-wide signals. They are kept in a per-item index
+//! instead, so a change in the item is delivered only to mappers of the item itself, of its parent
+//! and of its grandparent.
+
 class MVVM_MODEL_EXPORT ModelMapper : public ModelListenerInterface {
 public:
     ModelMapper(SessionModel* model);
@@ -29,26 +40,50 @@ public:
     ModelMapper(const ModelMapper& other) = delete;
     ModelMapper& operator=(const ModelMapper& other) = delete;
 
-    void setOnDataChange(Callbacks::item_int_t f, Callbacks::slot_t client) override;
-    void setOnItemInserted(Callbacks::item_tagrow_t f, Callbacks::slot_t client) override;
-    void setOnItemRemoved(Callbacks::item_tagrow_t f, Callbacks::slot_t client) override;
-    void setOnAboutToRemoveItem(Callbacks::item_tagrow_t f, Callbacks::slot_t client) override;
-    void setOnModelDestroyed(Callbacks::model_t f, Callbacks::slot_t client) override;
-    void setOnModelAboutToBeReset(Callbacks::model_t f, Callbacks::slot_t client) override;
-    void setOnModelReset(Callbacks::model_t f, Callbacks::slot_t client) override;
+    SignalConnection setOnDataChange(Callbacks::item_int_t f, Callbacks::slot_t client) override;
+    SignalConnection setOnItemInserted(Callbacks::item_tagrow_t f,
+                                       Callbacks::slot_t client) override;
+    SignalConnection setOnItemRemoved(Callbacks::item_tagrow_t f,
+                                      Callbacks::slot_t client) override;
+    SignalConnection setOnAboutToRemoveItem(Callbacks::item_tagrow_t f,
+                                            Callbacks::slot_t client) override;
+    SignalConnection setOnItemsInserted(Callbacks::item_range_t f,
+                                        Callbacks::slot_t client) override;
+    SignalConnection setOnItemsRemoved(Callbacks::item_range_t f,
+                                       Callbacks::slot_t client) override;
+    SignalConnection setOnAboutToRemoveItems(Callbacks::item_range_t f,
+                                             Callbacks::slot_t client) override;
+    SignalConnection setOnBatchFinished(Callbacks::model_t f, Callbacks::slot_t client) override;
+    SignalConnection setOnModelDestroyed(Callbacks::model_t f, Callbacks::slot_t client) override;
+    SignalConnection setOnModelAboutToBeReset(Callbacks::model_t f,
+                                              Callbacks::slot_t client) override;
+    SignalConnection setOnModelReset(Callbacks::model_t f, Callbacks::slot_t client) override;
 
     void setActive(bool value);
 
+    void beginBatch();
+    void endBatch();
+    void abortBatch();
+    bool isBatching() const;
+
+    void disconnect(SignalConnection connection) override;
+
     void unsubscribe(Callbacks::slot_t client) override;
 
 private:
     friend class SessionModel;
     friend class SessionItem;
+    friend class ItemMapper;
+
+    void registerItemMapper(ItemMapper* mapper, const SessionItem* item);
+    void unregisterItemMapper(ItemMapper* mapper, const SessionItem* item);
 
     void callOnDataChange(SessionItem* item, int role);
+    void prepareItemInsert(SessionItem* parent, const TagRow& tagrow);
     void callOnItemInserted(SessionItem* parent, const TagRow& tagrow);
     void callOnItemRemoved(SessionItem* parent, const TagRow& tagrow);
     void callOnItemAboutToBeRemoved(SessionItem* parent, const TagRow& tagrow);
+    void callOnItemsAboutToBeRemoved(SessionItem* parent, const TagRow& tagrow, int count);
     void callOnModelDestroyed();
     void callOnModelAboutToBeReset();
     void callOnModelReset();
@@ -68,7 +68,7 @@ Data2DItem* ColorMapViewportItem::data_item() const
 void ColorMapViewportItem::update_data_range()
 {
     if (auto dataItem = data_item(); dataItem) {
-        auto values = dataItem->content();
+        auto values = dataItem->contentArray();
         auto [lower, upper] = std::minmax_element(std::begin(values), std::end(values));
         zAxis()->set_range(*lower, *upper);
     }
@@ -8,6 +8,7 @@
 // ************************************************************************** //
 
 #include "mvvm/standarditems/data1ditem.h"
+#include "mvvm/model/customvariants.h"
 #include "mvvm/standarditems/axisitems.h"
 #include <stdexcept>
 
@@ -24,9 +25,9 @@ size_t total_bin_count(Data1DItem* item)
 Data1DItem::Data1DItem() : CompoundItem(Constants::Data1DItemType)
 {
     // prevent editing in widgets, since there is no corresponding editor
-    addProperty(P_VALUES, std::vector<double>())->setDisplayName("Values")->setEditable(false);
+    addProperty(P_VALUES, DoubleArray())->setDisplayName("Values")->setEditable(false);
 
-    addProperty(P_ERRORS, std::vector<double>())->setDisplayName("Errors")->setEditable(false);
+    addProperty(P_ERRORS, DoubleArray())->setDisplayName("Errors")->setEditable(false);
 
     registerTag(
         TagInfo(T_AXIS, 0, 1, {Constants::FixedBinAxisItemType, Constants::PointwiseAxisItemType}),
@@ -57,7 +58,14 @@ std::vector<double> Data1DItem::binCenters() const
 //! Sets internal data buffer to given data. If size of axis doesn't match the size of the data,
 //! exception will be thrown.
 
-void Data1DItem::setValues(const std::vector<double>& data)
+void Data1DItem::setValues(std::vector<double> data)
+{
+    setValuesArray(DoubleArray(std::move(data)));
+}
+
+//! Sets internal data buffer to given array. The buffer is shared with the array, not copied.
+
+void Data1DItem::setValuesArray(const DoubleArray& data)
 {
     if (total_bin_count(this) != data.size())
         throw std::runtime_error("Data1DItem::setValues() -> Data doesn't match size of axis");
@@ -69,12 +77,26 @@ void Data1DItem::setValues(const std::vector<double>& data)
 
 std::vector<double> Data1DItem::binValues() const
 {
-    return property<std::vector<double>>(P_VALUES);
+    return valuesArray().toVector();
+}
+
+//! Returns values stored in bins as shared array.
+
+DoubleArray Data1DItem::valuesArray() const
+{
+    return Utils::toDoubleArray(getItem(P_VALUES)->data<Variant>());
 }
 
 //! Sets errors on values in bins.
 
-void Data1DItem::setErrors(const std::vector<double>& errors)
+void Data1DItem::setErrors(std::vector<double> errors)
+{
+    setErrorsArray(DoubleArray(std::move(errors)));
+}
+
+//! Sets errors on values in bins. The buffer is shared with the array, not copied.
+
+void Data1DItem::setErrorsArray(const DoubleArray& errors)
 {
     if (total_bin_count(this) != errors.size())
         throw std::runtime_error("Data1DItem::setErrors() -> Data doesn't match size of axis");
@@ -86,5 +108,12 @@ void Data1DItem::setErrors(const std::vector<double>& errors)
 
 std::vector<double> Data1DItem::binErrors() const
 {
-    return property<std::vector<double>>(P_ERRORS);
+    return errorsArray().toVector();
+}
+
+//! Returns value errors stored in bins as shared array.
+
+DoubleArray Data1DItem::errorsArray() const
+{
+    return Utils::toDoubleArray(getItem(P_ERRORS)->data<Variant>());
 }
@@ -11,6 +11,7 @@
 #define MVVM_STANDARDITEMS_DATA1DITEM_H
 
 #include "mvvm/model/compounditem.h"
+#include "mvvm/model/doublearray.h"
 #include "mvvm/model/sessionmodel.h"
 #include <vector>
 
@@ -18,7 +19,8 @@ namespace ModelView {
 
 //! Represents one-dimensional data (axis and values).
 //! Values are stored in Data1DItem itself, axis is attached as a child. Corresponding plot
-//! properties will be served by GraphItem.
+//! properties will be served by GraphItem. Values and errors are kept as shared DoubleArray,
+//! valuesArray() and errorsArray() give access to them without copying.
 
 class MVVM_MODEL_EXPORT Data1DItem : public CompoundItem {
 public:
@@ -32,11 +34,15 @@ public:
 
     std::vector<double> binCenters() const;
 
-    void setValues(const std::vector<double>& data);
+    void setValues(std::vector<double> data);
+    void setValuesArray(const DoubleArray& data);
     std::vector<double> binValues() const;
+    DoubleArray valuesArray() const;
 
-    void setErrors(const std::vector<double>& errors);
+    void setErrors(std::vector<double> errors);
+    void setErrorsArray(const DoubleArray& errors);
     std::vector<double> binErrors() const;
+    DoubleArray errorsArray() const;
 
     //! Inserts axis of given type.
     template <typename T, typename... Args> T* setAxis(Args&&... args);
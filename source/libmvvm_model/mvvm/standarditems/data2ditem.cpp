@@ -8,6 +8,7 @@
 // ************************************************************************** //
 
 #include "mvvm/standarditems/data2ditem.h"
+#include "mvvm/model/customvariants.h"
 #include "mvvm/standarditems/axisitems.h"
 #include <stdexcept>
 
@@ -26,7 +27,7 @@ size_t total_bin_count(Data2DItem* item)
 Data2DItem::Data2DItem() : CompoundItem(Constants::Data2DItemType)
 {
     // prevent editing in widgets, since there is no corresponding editor
-    addProperty(P_VALUES, std::vector<double>())->setDisplayName("Values")->setEditable(false);
+    addProperty(P_VALUES, DoubleArray())->setDisplayName("Values")->setEditable(false);
 
     registerTag(TagInfo(T_XAXIS, 0, 1, {Constants::FixedBinAxisItemType}));
     registerTag(TagInfo(T_YAXIS, 0, 1, {Constants::FixedBinAxisItemType}));
@@ -56,7 +57,17 @@ BinnedAxisItem* Data2DItem::yAxis() const
     return item<BinnedAxisItem>(T_YAXIS);
 }
 
-void Data2DItem::setContent(const std::vector<double>& data)
+//! Sets 1d buffer representing 2d data. If size of axes doesn't match the size of the data,
+//! exception will be thrown.
+
+void Data2DItem::setContent(std::vector<double> data)
+{
+    setContentArray(DoubleArray(std::move(data)));
+}
+
+//! Sets 1d buffer representing 2d data. The buffer is shared with the array, not copied.
+
+void Data2DItem::setContentArray(const DoubleArray& data)
 {
     if (total_bin_count(this) != data.size())
         throw std::runtime_error("Data1DItem::setContent() -> Data doesn't match size of axis");
@@ -67,7 +78,14 @@ void Data2DItem::setContent(const std::vector<double>& data)
 
 std::vector<double> Data2DItem::content() const
 {
-    return property<std::vector<double>>(P_VALUES);
+    return contentArray().toVector();
+}
+
+//! Returns 1d buffer representing 2d data as shared array.
+
+DoubleArray Data2DItem::contentArray() const
+{
+    return Utils::toDoubleArray(getItem(P_VALUES)->data<Variant>());
 }
 
 //! Insert axis under given tag. Previous axis will be deleted and data points invalidated.
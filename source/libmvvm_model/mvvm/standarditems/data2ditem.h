@@ -11,6 +11,7 @@
 #define MVVM_STANDARDITEMS_DATA2DITEM_H
 
 #include "mvvm/model/compounditem.h"
+#include "mvvm/model/doublearray.h"
 #include <vector>
 
 namespace ModelView {
@@ -19,7 +20,8 @@ class BinnedAxisItem;
 
 //! Represents two-dimensional data (axes definition and 2d array of values).
 //! Values are stored in Data2DItem itself, axes are attached as children. Corresponding plot
-//! properties will be served by ColorMapItem.
+//! properties will be served by ColorMapItem. Values are kept as shared DoubleArray, contentArray()
+//! gives access to them without copying.
 
 class MVVM_MODEL_EXPORT Data2DItem : public CompoundItem {
 public:
@@ -35,10 +37,14 @@ public:
 
     BinnedAxisItem* yAxis() const;
 
-    void setContent(const std::vector<double>& data);
+    void setContent(std::vector<double> data);
+
+    void setContentArray(const DoubleArray& data);
 
     std::vector<double> content() const;
 
+    DoubleArray contentArray() const;
+
 private:
     void insert_axis(std::unique_ptr<BinnedAxisItem> axis, const std::string& tag);
 };
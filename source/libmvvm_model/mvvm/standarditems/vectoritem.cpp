@@ -24,6 +24,11 @@ VectorItem::VectorItem() : CompoundItem(Constants::VectorItemType)
     update_label();
 }
 
+VectorItem::VectorItem(const VectorItem& prototype, ItemStampTag tag)
+    : CompoundItem(prototype, tag)
+{
+}
+
 void VectorItem::activate()
 {
     auto on_property_change = [this](SessionItem*, const std::string&) { update_label(); };
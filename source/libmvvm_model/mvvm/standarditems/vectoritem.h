@@ -23,6 +23,7 @@ public:
     static inline const std::string P_Z = "P_Z";
 
     VectorItem();
+    VectorItem(const VectorItem& prototype, ItemStampTag tag);
 
     void activate() override;
 
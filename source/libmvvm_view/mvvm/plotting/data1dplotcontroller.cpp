@@ -10,8 +10,11 @@
 #include "mvvm/plotting/data1dplotcontroller.h"
 #include "mvvm/standarditems/data1ditem.h"
 #include <qcustomplot.h>
+#include <algorithm>
 #include <stdexcept>
 
+using namespace ModelView;
+
 namespace {
 template <typename T> QVector<T> fromStdVector(const std::vector<T>& vec)
 {
@@ -21,9 +24,14 @@ template <typename T> QVector<T> fromStdVector(const std::vector<T>& vec)
     return QVector<T>::fromStdVector(vec);
 #endif
 }
-} // namespace
 
-using namespace ModelView;
+QVector<double> fromDoubleArray(const DoubleArray& array)
+{
+    QVector<double> result(static_cast<int>(array.size()));
+    std::copy(array.begin(), array.end(), result.begin());
+    return result;
+}
+} // namespace
 
 struct Data1DPlotController::Data1DPlotControllerImpl {
     QCPGraph* m_graph{nullptr};
@@ -45,13 +53,13 @@ struct Data1DPlotController::Data1DPlotControllerImpl {
     void updateGraphPointsFromItem(Data1DItem* item)
     {
         m_graph->setData(fromStdVector<double>(item->binCenters()),
-                         fromStdVector<double>(item->binValues()));
+                         fromDoubleArray(item->valuesArray()));
         customPlot()->replot();
     }
 
     void updateErrorBarsFromItem(Data1DItem* item)
     {
-        auto errors = item->binErrors();
+        auto errors = item->errorsArray();
         if (errors.empty()) {
             resetErrorBars();
             return;
@@ -60,7 +68,7 @@ struct Data1DPlotController::Data1DPlotControllerImpl {
         if (!m_errorBars)
             m_errorBars = new QCPErrorBars(customPlot()->xAxis, customPlot()->yAxis);
 
-        m_errorBars->setData(fromStdVector<double>(errors));
+        m_errorBars->setData(fromDoubleArray(errors));
         m_errorBars->setDataPlottable(m_graph);
     }
 
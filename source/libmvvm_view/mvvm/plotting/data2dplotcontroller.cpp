@@ -51,7 +51,7 @@ struct Data2DPlotController::Data2DPlotControllerImpl {
                 color_map->data()->setSize(nbinsx, nbinsy);
                 color_map->data()->setRange(qcpRange(xAxis), qcpRange(yAxis));
 
-                auto values = data_item->content();
+                auto values = data_item->contentArray(); // shared with the model, no copy
                 for (int ix = 0; ix < nbinsx; ++ix)
                     for (int iy = 0; iy < nbinsy; ++iy)
                         color_map->data()->setCell(ix, iy,
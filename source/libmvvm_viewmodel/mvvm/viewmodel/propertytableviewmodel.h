@@ -25,6 +25,9 @@ public:
     PropertyTableViewModel(SessionModel* model, QObject* parent = nullptr);
 
     void insertRow(ViewItem* parent, int row, std::vector<std::unique_ptr<ViewItem>> items) override;
+
+    void insertRows(ViewItem* parent, int row,
+                    std::vector<std::vector<std::unique_ptr<ViewItem>>> rows) override;
 };
 
 } // namespace ModelView
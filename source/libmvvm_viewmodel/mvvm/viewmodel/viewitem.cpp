@@ -13,6 +13,7 @@
 #include "mvvm/utils/containerutils.h"
 #include "mvvm/viewmodel/viewmodelutils.h"
 #include <algorithm>
+#include <iterator>
 #include <stdexcept>
 #include <vector>
 
@@ -51,6 +52,34 @@ struct ViewItem::ViewItemImpl {
         ++rows;
     }
 
+    //! Inserts several rows at once, shifting existing children only once.
+    void insertRows(int row, std::vector<std::vector<std::unique_ptr<ViewItem>>> new_rows)
+    {
+        if (new_rows.empty())
+            return;
+
+        if (row < 0 || row > rows)
+            throw std::runtime_error("Error in ViewItemImpl: invalid row index.");
+
+        const size_t new_columns = columns > 0 ? static_cast<size_t>(columns) : new_rows[0].size();
+        std::vector<std::unique_ptr<ViewItem>> buffer;
+        buffer.reserve(new_columns * new_rows.size());
+        for (auto& items : new_rows) {
+            if (items.empty())
+                throw std::runtime_error("Error in ViewItemImpl: attempt to insert empty row");
+            if (items.size() != new_columns)
+                throw std::runtime_error("Error in ViewItemImpl: wrong number of columns.");
+            std::move(items.begin(), items.end(), std::back_inserter(buffer));
+        }
+
+        children.insert(std::next(children.begin(), row * columns),
+                        std::make_move_iterator(buffer.begin()),
+                        std::make_move_iterator(buffer.end()));
+
+        columns = static_cast<int>(new_columns);
+        rows += static_cast<int>(new_rows.size());
+    }
+
     void removeRow(int row)
     {
         if (row < 0 || row >= rows)
@@ -64,6 +93,20 @@ struct ViewItem::ViewItemImpl {
             columns = 0;
     }
 
+    //! Removes several rows at once, shifting remaining children only once.
+    void removeRows(int row, int count)
+    {
+        if (row < 0 || count < 0 || row + count > rows)
+            throw std::runtime_error("Error in RefViewItem: invalid row index.");
+
+        auto begin = std::next(children.begin(), row * columns);
+        auto end = std::next(begin, count * columns);
+        children.erase(begin, end);
+        rows -= count;
+        if (rows == 0)
+            columns = 0;
+    }
+
     ViewItem* child(int row, int column) const
     {
         if (row < 0 || row >= rows)
@@ -136,6 +179,16 @@ void ViewItem::insertRow(int row, std::vector<std::unique_ptr<ViewItem>> items)
     p_impl->insertRow(row, std::move(items));
 }
 
+//! Inserts several rows of items starting from index 'row'.
+
+void ViewItem::insertRows(int row, std::vector<std::vector<std::unique_ptr<ViewItem>>> rows)
+{
+    for (auto& items : rows)
+        for (auto& x : items)
+            x->setParent(this);
+    p_impl->insertRows(row, std::move(rows));
+}
+
 //! Removes row of items at given 'row'. Items will be deleted.
 
 void ViewItem::removeRow(int row)
@@ -143,6 +196,13 @@ void ViewItem::removeRow(int row)
     p_impl->removeRow(row);
 }
 
+//! Removes 'count' rows of items starting from given 'row'. Items will be deleted.
+
+void ViewItem::removeRows(int row, int count)
+{
+    p_impl->removeRows(row, count);
+}
+
 void ViewItem::clear()
 {
     p_impl->children.clear();
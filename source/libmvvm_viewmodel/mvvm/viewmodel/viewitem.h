@@ -33,8 +33,12 @@ public:
 
     void insertRow(int row, std::vector<std::unique_ptr<ViewItem>> items);
 
+    void insertRows(int row, std::vector<std::vector<std::unique_ptr<ViewItem>>> rows);
+
     void removeRow(int row);
 
+    void removeRows(int row, int count);
+
     void clear();
 
     ViewItem* parent() const;
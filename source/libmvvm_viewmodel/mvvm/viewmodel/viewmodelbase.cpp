@@ -127,6 +127,23 @@ void ViewModelBase::removeRow(ViewItem* parent, int row)
     endRemoveRows();
 }
 
+//! Removes 'count' rows of items starting from given 'row'. Views are notified about the whole
+//! range at once.
+
+void ViewModelBase::removeRows(ViewItem* parent, int row, int count)
+{
+    if (!p_impl->item_belongs_to_model(parent))
+        throw std::runtime_error(
+            "Error in ViewModelBase: attempt to use parent from another model");
+
+    if (count <= 0)
+        return;
+
+    beginRemoveRows(indexFromItem(parent), row, row + count - 1);
+    parent->removeRows(row, count);
+    endRemoveRows();
+}
+
 void ViewModelBase::clearRows(ViewItem* parent)
 {
     if (!p_impl->item_belongs_to_model(parent))
@@ -162,6 +179,24 @@ void ViewModelBase::appendRow(ViewItem* parent, std::vector<std::unique_ptr<View
     insertRow(parent, parent->rowCount(), std::move(items));
 }
 
+//! Inserts several rows of items starting from index 'row' to given parent. Views are notified
+//! about the whole range at once.
+
+void ViewModelBase::insertRows(ViewItem* parent, int row,
+                               std::vector<std::vector<std::unique_ptr<ViewItem>>> rows)
+{
+    if (!p_impl->item_belongs_to_model(parent))
+        throw std::runtime_error(
+            "Error in ViewModelBase: attempt to use parent from another model");
+
+    if (rows.empty())
+        return;
+
+    beginInsertRows(indexFromItem(parent), row, row + static_cast<int>(rows.size()) - 1);
+    parent->insertRows(row, std::move(rows));
+    endInsertRows();
+}
+
 //! Returns the item flags for the given index.
 
 Qt::ItemFlags ViewModelBase::flags(const QModelIndex& index) const
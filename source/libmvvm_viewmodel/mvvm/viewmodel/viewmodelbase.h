@@ -51,12 +51,17 @@ public:
 
     void removeRow(ViewItem* parent, int row);
 
+    void removeRows(ViewItem* parent, int row, int count);
+
     void clearRows(ViewItem* parent);
 
     virtual void insertRow(ViewItem* parent, int row, std::vector<std::unique_ptr<ViewItem>> items);
 
     void appendRow(ViewItem* parent, std::vector<std::unique_ptr<ViewItem>> items);
 
+    virtual void insertRows(ViewItem* parent, int row,
+                            std::vector<std::vector<std::unique_ptr<ViewItem>>> rows);
+
     Qt::ItemFlags flags(const QModelIndex& index) const override;
 
 private:
@@ -101,6 +101,42 @@ struct ViewModelController::ViewModelControllerImpl {
         }
     }
 
+    //! Removes views of children occupying rows [tagrow.row, tagrow.row + count) of parent's tag.
+    //! Views sitting in consecutive rows of the same parent view are removed at once.
+    void remove_views(SessionItem* parent, const TagRow& tagrow, int count)
+    {
+        ViewItem* parent_view{nullptr};
+        int first_row{-1};
+        int row_count{0};
+        auto flush_rows = [&]() {
+            if (row_count > 0)
+                m_viewModel->removeRows(parent_view, first_row, row_count);
+            row_count = 0;
+        };
+
+        for (int offset = 0; offset < count; ++offset) {
+            auto pos = m_itemToVview.find(parent->getItem(tagrow.tag, tagrow.row + offset));
+            if (pos == m_itemToVview.end())
+                continue;
+            auto view = pos->second;
+            m_itemToVview.erase(pos);
+
+            // consecutive children are usually shown in consecutive rows
+            const int next_row = first_row + row_count;
+            if (row_count > 0 && view->parent() == parent_view
+                && next_row < parent_view->rowCount() && parent_view->child(next_row, 0) == view) {
+                ++row_count;
+                continue;
+            }
+
+            flush_rows();
+            parent_view = view->parent();
+            first_row = view->row();
+            row_count = 1;
+        }
+        flush_rows();
+    }
+
     void remove_children_of_view(ViewItem* view)
     {
         for (auto child : view->children()) {
@@ -137,6 +173,68 @@ struct ViewModelController::ViewModelControllerImpl {
         }
     }
 
+    //! Inserts views of children occupying rows [tagrow.row, tagrow.row + count) of parent's tag.
+    //! Views of consecutive children are inserted into the view model at once, together with
+    //! their branches.
+    void insert_views(SessionItem* parent, const TagRow& tagrow, int count)
+    {
+        auto pos = m_itemToVview.find(parent);
+        if (pos == m_itemToVview.end())
+            return;
+        auto parent_view = pos->second;
+
+        auto children = m_childrenStrategy->children(parent);
+        std::vector<std::vector<std::unique_ptr<ViewItem>>> rows;
+        int first_index{-1};
+        auto flush_rows = [&]() {
+            if (!rows.empty())
+                m_viewModel->insertRows(parent_view, first_index, std::move(rows));
+            rows.clear();
+        };
+
+        int index{-1};
+        for (int offset = 0; offset < count; ++offset) {
+            auto child = parent->getItem(tagrow.tag, tagrow.row + offset);
+            // consecutive children usually stay consecutive in the list of children to show
+            auto next = static_cast<size_t>(index + 1);
+            if (index >= 0 && next < children.size() && children[next] == child)
+                ++index;
+            else
+                index = Utils::IndexOfItem(children, child);
+            if (index == -1)
+                continue;
+
+            auto row = m_rowStrategy->constructRow(child);
+            if (row.empty())
+                continue;
+
+            if (!rows.empty() && index != first_index + static_cast<int>(rows.size()))
+                flush_rows();
+            if (rows.empty())
+                first_index = index;
+
+            auto next_parent = row.at(0).get();
+            m_itemToVview[child] = next_parent;
+            build_branch(child, next_parent);
+            rows.push_back(std::move(row));
+        }
+        flush_rows();
+    }
+
+    //! Builds views of the item's branch under the view, which is not yet a part of the view model.
+    void build_branch(const SessionItem* item, ViewItem* parent)
+    {
+        for (auto child : m_childrenStrategy->children(item)) {
+            auto row = m_rowStrategy->constructRow(child);
+            if (!row.empty()) {
+                auto next_parent = row.at(0).get();
+                parent->appendRow(std::move(row));
+                m_itemToVview[child] = next_parent;
+                build_branch(child, next_parent);
+            }
+        }
+    }
+
     std::vector<ViewItem*> findViews(const SessionItem* item) const
     {
         if (item == m_viewModel->rootItem()->item())
@@ -166,20 +264,20 @@ ViewModelController::ViewModelController(SessionModel* session_model, ViewModelB
     auto on_data_change = [this](SessionItem* item, int role) { onDataChange(item, role); };
     setOnDataChange(on_data_change);
 
-    auto on_item_inserted = [this](SessionItem* item, TagRow tagrow) {
-        onItemInserted(item, std::move(tagrow));
+    auto on_items_inserted = [this](SessionItem* item, const TagRow& tagrow, int count) {
+        onItemsInserted(item, tagrow, count);
     };
-    setOnItemInserted(on_item_inserted);
+    setOnItemsInserted(on_items_inserted);
 
     auto on_item_removed = [this](SessionItem* item, TagRow tagrow) {
         onItemRemoved(item, std::move(tagrow));
     };
     setOnItemRemoved(on_item_removed);
 
-    auto on_about_to_remove = [this](SessionItem* item, TagRow tagrow) {
-        onAboutToRemoveItem(item, std::move(tagrow));
+    auto on_about_to_remove = [this](SessionItem* item, const TagRow& tagrow, int count) {
+        onAboutToRemoveItems(item, tagrow, count);
     };
-    setOnAboutToRemoveItem(on_about_to_remove);
+    setOnAboutToRemoveItems(on_about_to_remove);
 
     auto on_model_destroyed = [this](auto) {
         p_impl->m_viewModel->setRootViewItem(std::make_unique<RootViewItem>(nullptr));
@@ -272,6 +370,17 @@ void ViewModelController::onItemInserted(SessionItem* parent, TagRow tagrow)
     p_impl->insert_view(parent, tagrow);
 }
 
+//! Processes insertion of children occupying rows [tagrow.row, tagrow.row + count). Insertion of
+//! the single child is forwarded to onItemInserted.
+
+void ViewModelController::onItemsInserted(SessionItem* parent, const TagRow& tagrow, int count)
+{
+    if (count == 1)
+        onItemInserted(parent, tagrow);
+    else
+        p_impl->insert_views(parent, tagrow, count);
+}
+
 void ViewModelController::onItemRemoved(SessionItem*, TagRow) {}
 
 void ViewModelController::onAboutToRemoveItem(SessionItem* parent, TagRow tagrow)
@@ -292,6 +401,25 @@ void ViewModelController::onAboutToRemoveItem(SessionItem* parent, TagRow tagrow
     }
 }
 
+//! Processes removal of children occupying rows [tagrow.row, tagrow.row + count). Removal of
+//! the single child, or of the range containing our root item, is forwarded to
+//! onAboutToRemoveItem.
+
+void ViewModelController::onAboutToRemoveItems(SessionItem* parent, const TagRow& tagrow,
+                                               int count)
+{
+    if (count == 1)
+        return onAboutToRemoveItem(parent, tagrow);
+
+    for (int offset = 0; offset < count; ++offset) {
+        auto item = parent->getItem(tagrow.tag, tagrow.row + offset);
+        if (item == rootSessionItem() || Utils::IsItemAncestor(rootSessionItem(), item))
+            return onAboutToRemoveItem(parent, {tagrow.tag, tagrow.row + offset});
+    }
+
+    p_impl->remove_views(parent, tagrow, count);
+}
+
 void ViewModelController::update_branch(const SessionItem* item)
 {
     auto views = findViews(item);
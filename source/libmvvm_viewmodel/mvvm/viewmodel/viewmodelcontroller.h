@@ -51,8 +51,10 @@ public:
 protected:
     virtual void onDataChange(SessionItem* item, int role);
     virtual void onItemInserted(SessionItem* parent, TagRow tagrow);
+    virtual void onItemsInserted(SessionItem* parent, const TagRow& tagrow, int count);
     virtual void onItemRemoved(SessionItem* parent, TagRow tagrow);
     virtual void onAboutToRemoveItem(SessionItem* parent, TagRow tagrow);
+    virtual void onAboutToRemoveItems(SessionItem* parent, const TagRow& tagrow, int count);
 
     void update_branch(const SessionItem* item);
 
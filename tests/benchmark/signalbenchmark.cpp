@@ -0,0 +1,115 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/model/tagrow.h"
+#include "mvvm/signals/callbackcontainer.h"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <list>
+#include <string>
+
+using namespace ModelView;
+
+//! Microbenchmark of signal dispatch: current Signal against former std::list based container.
+
+namespace {
+
+//! Former implementation of the callback container, kept for comparison.
+
+template <typename T, typename U> class ListSignal {
+public:
+    void connect(T callback, U client) { m_callbacks.push_back(std::make_pair(callback, client)); }
+
+    template <typename... Args> void operator()(Args... args)
+    {
+        for (const auto& f : m_callbacks)
+            f.first(args...);
+    }
+
+    void remove_client(U client)
+    {
+        m_callbacks.remove_if([client](const std::pair<T, U>& x) { return x.second == client; });
+    }
+
+private:
+    std::list<std::pair<T, U>> m_callbacks;
+};
+
+template <typename Func> double measure(int repetitions, Func func)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < repetitions; ++i)
+        func();
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / repetitions;
+}
+
+void report(const std::string& name, double legacy, double current)
+{
+    std::cout << std::left << std::setw(40) << name << std::right << std::setw(12) << legacy
+              << std::setw(12) << current << "\n";
+}
+
+//! Emission with arguments typical for ModelMapper notifications.
+
+template <typename Container> double emission(int clients, int repetitions)
+{
+    Container signal;
+    int counter{0};
+    std::vector<int> owners(static_cast<size_t>(clients));
+    for (auto& owner : owners)
+        signal.connect([&counter](SessionItem*, const TagRow& tagrow) { counter += tagrow.row; },
+                       &owner);
+
+    TagRow tagrow{"tag", 1};
+    return measure(repetitions, [&]() { signal(nullptr, tagrow); });
+}
+
+//! Connection and disconnection of all clients, in the order of connection.
+
+template <typename Container> double subscription(int clients, int repetitions)
+{
+    std::vector<int> owners(static_cast<size_t>(clients));
+    return measure(repetitions, [&]() {
+        Container signal;
+        for (auto& owner : owners)
+            signal.connect([](SessionItem*, const TagRow&) {}, &owner);
+        for (auto& owner : owners)
+            signal.remove_client(&owner);
+    });
+}
+
+} // namespace
+
+int main()
+{
+    using legacy_t = ListSignal<std::function<void(SessionItem*, TagRow)>, Callbacks::slot_t>;
+    using current_t = Signal<Callbacks::item_tagrow_t>;
+
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << std::left << std::setw(40) << "ns per operation" << std::right << std::setw(12)
+              << "list" << std::setw(12) << "vector"
+              << "\n";
+
+    for (int clients : {1, 10, 100}) {
+        const int repetitions = 1000000 / clients;
+        report("emit, " + std::to_string(clients) + " clients",
+               emission<legacy_t>(clients, repetitions), emission<current_t>(clients, repetitions));
+    }
+
+    for (int clients : {10, 100, 1000}) {
+        const int repetitions = 100000 / clients;
+        report("connect/remove, " + std::to_string(clients) + " clients",
+               subscription<legacy_t>(clients, repetitions),
+               subscription<current_t>(clients, repetitions));
+    }
+
+    return 0;
+}
@@ -103,3 +103,113 @@ TEST_F(CallbackContainerTest, twoParameters)
     // perform action
     signal(item.get(), expected_role);
 }
+
+//! Disconnection of single callback using connection handle.
+
+TEST_F(CallbackContainerTest, disconnectByHandle)
+{
+    CallbackMockWidget widget;
+    Signal<Callbacks::item_t> signal;
+
+    auto connection1 =
+        signal.connect([&](SessionItem* item) { widget.onItemDestroy(item); }, &widget);
+    auto connection2 =
+        signal.connect([&](SessionItem* item) { widget.onDataChange(item, 0); }, &widget);
+    EXPECT_TRUE(signal.isConnected(connection1));
+    EXPECT_TRUE(signal.isConnected(connection2));
+    EXPECT_EQ(signal.size(), 2);
+
+    signal.disconnect(connection1);
+    EXPECT_FALSE(signal.isConnected(connection1));
+    EXPECT_TRUE(signal.isConnected(connection2));
+    EXPECT_EQ(signal.size(), 1);
+
+    std::unique_ptr<SessionItem> item(new SessionItem);
+    EXPECT_CALL(widget, onItemDestroy(_)).Times(0);
+    EXPECT_CALL(widget, onDataChange(item.get(), 0)).Times(1);
+
+    // perform action
+    signal(item.get());
+}
+
+//! Stale handle doesn't affect connection which took its place.
+
+TEST_F(CallbackContainerTest, staleHandle)
+{
+    Signal<Callbacks::item_t> signal;
+    int counter{0};
+
+    auto connection1 = signal.connect([&](SessionItem*) { ++counter; }, nullptr);
+    signal.disconnect(connection1);
+    EXPECT_FALSE(SignalConnection().isValid());
+
+    auto connection2 = signal.connect([&](SessionItem*) { counter += 10; }, nullptr);
+    signal.disconnect(connection1);
+    EXPECT_TRUE(signal.isConnected(connection2));
+
+    signal(nullptr);
+    EXPECT_EQ(counter, 10);
+}
+
+//! Callbacks connect and disconnect during the emission.
+
+TEST_F(CallbackContainerTest, reentrantConnection)
+{
+    Signal<Callbacks::item_t> signal;
+    std::vector<int> calls;
+
+    SignalConnection self;
+    self = signal.connect(
+        [&](SessionItem*) {
+            calls.push_back(1);
+            signal.disconnect(self);
+            signal.connect([&](SessionItem*) { calls.push_back(3); }, nullptr);
+        },
+        nullptr);
+    auto connection2 = signal.connect([&](SessionItem*) { calls.push_back(2); }, nullptr);
+
+    // connection made during the emission is called only next time
+    signal(nullptr);
+    EXPECT_EQ(calls, std::vector<int>({1, 2}));
+    EXPECT_FALSE(signal.isConnected(self));
+    EXPECT_EQ(signal.size(), 2);
+
+    calls.clear();
+    signal(nullptr);
+    EXPECT_EQ(calls, std::vector<int>({2, 3}));
+
+    // callback disconnecting another one, which is next in the list
+    calls.clear();
+    signal.disconnect(connection2);
+    SignalConnection next;
+    signal.connect(
+        [&](SessionItem*) {
+            calls.push_back(4);
+            signal.disconnect(next);
+        },
+        nullptr);
+    next = signal.connect([&](SessionItem*) { calls.push_back(5); }, nullptr);
+    signal(nullptr);
+    EXPECT_EQ(calls, std::vector<int>({3, 4}));
+    EXPECT_FALSE(signal.isConnected(next));
+
+    calls.clear();
+    signal(nullptr);
+    EXPECT_EQ(calls, std::vector<int>({3, 4}));
+}
+
+//! Handle issued by one signal doesn't affect another.
+
+TEST_F(CallbackContainerTest, foreignHandle)
+{
+    Signal<Callbacks::item_t> signal1;
+    Signal<Callbacks::item_t> signal2;
+
+    auto connection1 = signal1.connect([](SessionItem*) {}, nullptr);
+    auto connection2 = signal2.connect([](SessionItem*) {}, nullptr);
+    EXPECT_FALSE(signal2.isConnected(connection1));
+
+    signal2.disconnect(connection1);
+    EXPECT_TRUE(signal1.isConnected(connection1));
+    EXPECT_TRUE(signal2.isConnected(connection2));
+}
@@ -151,6 +151,35 @@ TEST_F(Data1DItemTest, setErrors)
     EXPECT_EQ(item.binErrors(), expected_errors);
 }
 
+//! Checking that values are shared between the item and the caller.
+
+TEST_F(Data1DItemTest, valuesArray)
+{
+    Data1DItem item;
+    EXPECT_TRUE(item.valuesArray().empty());
+    EXPECT_TRUE(item.errorsArray().empty());
+
+    item.setAxis<FixedBinAxisItem>(3, 0.0, 3.0);
+
+    DoubleArray values(std::vector<double>{1.0, 2.0, 3.0});
+    item.setValuesArray(values);
+    EXPECT_TRUE(item.valuesArray().isSharedWith(values));
+    EXPECT_TRUE(item.valuesArray().isSharedWith(item.valuesArray()));
+    EXPECT_EQ(item.binValues(), values.toVector());
+
+    DoubleArray errors(std::vector<double>{0.1, 0.2, 0.3});
+    item.setErrorsArray(errors);
+    EXPECT_TRUE(item.errorsArray().isSharedWith(errors));
+    EXPECT_EQ(item.binErrors(), errors.toVector());
+
+    EXPECT_THROW(item.setValuesArray(DoubleArray(std::vector<double>{1.0})), std::runtime_error);
+
+    // brace-initialized values are not ambiguous
+    EXPECT_THROW(item.setValues({}), std::runtime_error);
+    item.setValues({4.0, 5.0, 6.0});
+    EXPECT_EQ(item.binValues(), std::vector<double>({4.0, 5.0, 6.0}));
+}
+
 //! Checking the signals when axes changed.
 
 TEST_F(Data1DItemTest, checkSignalsOnAxisChange)
@@ -71,6 +71,25 @@ TEST_F(Data2DItemTest, setContent)
     EXPECT_EQ(item.content(), expected_content);
 }
 
+//! Checking that content is shared between the item and the caller.
+
+TEST_F(Data2DItemTest, contentArray)
+{
+    Data2DItem item;
+    EXPECT_TRUE(item.contentArray().empty());
+
+    item.setAxes(FixedBinAxisItem::create(1, 0.0, 5.0), FixedBinAxisItem::create(2, 0.0, 3.0));
+    EXPECT_EQ(item.contentArray().toVector(), std::vector<double>({0.0, 0.0}));
+
+    DoubleArray content(std::vector<double>{1.0, 2.0});
+    item.setContentArray(content);
+    EXPECT_TRUE(item.contentArray().isSharedWith(content));
+    EXPECT_EQ(item.content(), content.toVector());
+
+    EXPECT_THROW(item.setContentArray(DoubleArray(std::vector<double>{1.0})), std::runtime_error);
+    EXPECT_THROW(item.setContent({}), std::runtime_error);
+}
+
 //! Checking the signals when axes changed.
 
 TEST_F(Data2DItemTest, checkSignalsOnAxisChange)
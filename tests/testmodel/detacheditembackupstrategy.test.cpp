@@ -0,0 +1,117 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/commands/detacheditembackupstrategy.h"
+
+#include "google_test.h"
+#include "mvvm/interfaces/undostackinterface.h"
+#include "mvvm/model/compounditem.h"
+#include "mvvm/model/sessionmodel.h"
+#include "mvvm/signals/itemmapper.h"
+#include <stdexcept>
+#include <vector>
+
+using namespace ModelView;
+
+class DetachedItemBackupStrategyTest : public ::testing::Test {
+};
+
+//! Keeping/restoring single item gives back the same object.
+
+TEST_F(DetachedItemBackupStrategyTest, keepItem)
+{
+    DetachedItemBackupStrategy strategy;
+
+    auto item = std::make_unique<CompoundItem>();
+    auto property = item->addProperty("thickness", 42.0);
+    auto item_ptr = item.get();
+
+    strategy.keepItem(std::move(item));
+    EXPECT_GT(strategy.memoryFootprint(), 0u);
+
+    auto restored = strategy.restoreItem();
+    EXPECT_EQ(restored.get(), item_ptr);
+    EXPECT_EQ(restored->getItem("thickness"), property);
+    EXPECT_EQ(strategy.memoryFootprint(), 0u);
+
+    // item was handed back, nothing left to restore
+    EXPECT_THROW(strategy.restoreItem(), std::runtime_error);
+}
+
+//! Keeping/restoring several items.
+
+TEST_F(DetachedItemBackupStrategyTest, keepItems)
+{
+    DetachedItemBackupStrategy strategy;
+
+    std::vector<std::unique_ptr<SessionItem>> items;
+    items.push_back(std::make_unique<SessionItem>());
+    items.push_back(std::make_unique<SessionItem>());
+    auto item0 = items[0].get();
+    auto item1 = items[1].get();
+
+    strategy.keepItems(std::move(items));
+    EXPECT_GT(strategy.memoryFootprint(), 0u);
+
+    auto restored = strategy.restoreItems();
+    ASSERT_EQ(restored.size(), 2u);
+    EXPECT_EQ(restored[0].get(), item0);
+    EXPECT_EQ(restored[1].get(), item1);
+    EXPECT_EQ(strategy.memoryFootprint(), 0u);
+    EXPECT_TRUE(strategy.restoreItems().empty());
+}
+
+//! Footprint of kept items accounts for the data of the whole subtree.
+
+TEST_F(DetachedItemBackupStrategyTest, memoryFootprint)
+{
+    DetachedItemBackupStrategy strategy;
+    strategy.keepItem(std::make_unique<CompoundItem>());
+    const auto empty_footprint = strategy.memoryFootprint();
+    EXPECT_GT(empty_footprint, sizeof(SessionItem));
+
+    auto item = std::make_unique<CompoundItem>();
+    item->addProperty("values", std::vector<double>(1000, 42.0));
+    strategy.keepItem(std::move(item));
+    EXPECT_GT(strategy.memoryFootprint(), empty_footprint + 1000 * sizeof(double));
+}
+
+//! Removal of item with undo enabled, followed by undo and redo. The same item is reinserted and
+//! registered in the pool again. Subscribers of the removed item are notified as on destruction.
+
+TEST_F(DetachedItemBackupStrategyTest, removeAndUndo)
+{
+    SessionModel model;
+    model.setUndoRedoEnabled(true);
+    auto item = model.insertItem<CompoundItem>();
+    auto property = item->addProperty("thickness", 42.0);
+    auto identifier = item->identifier();
+    auto property_identifier = property->identifier();
+
+    int destroyed_count{0};
+    item->mapper()->setOnItemDestroy([&destroyed_count](SessionItem*) { ++destroyed_count; },
+                                     this);
+
+    model.removeItem(model.rootItem(), {"", 0});
+    EXPECT_EQ(destroyed_count, 1);
+    EXPECT_EQ(model.findItem(identifier), nullptr);
+    EXPECT_EQ(model.findItem(property_identifier), nullptr);
+
+    model.undoStack()->undo();
+    EXPECT_EQ(model.rootItem()->childrenCount(), 1);
+    EXPECT_EQ(model.findItem(identifier), item);
+    EXPECT_EQ(model.findItem(property_identifier), property);
+    EXPECT_EQ(item->model(), &model);
+    EXPECT_EQ(property->data<double>(), 42.0);
+
+    model.undoStack()->redo();
+    EXPECT_EQ(model.rootItem()->childrenCount(), 0);
+    EXPECT_EQ(model.findItem(identifier), nullptr);
+    EXPECT_EQ(destroyed_count, 1);
+}
@@ -0,0 +1,99 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/model/doublearray.h"
+
+#include "google_test.h"
+#include "mvvm/model/customvariants.h"
+#include <vector>
+
+using namespace ModelView;
+
+//! Testing DoubleArray.
+
+class DoubleArrayTest : public ::testing::Test {
+};
+
+TEST_F(DoubleArrayTest, initialState)
+{
+    DoubleArray array;
+    EXPECT_TRUE(array.empty());
+    EXPECT_EQ(array.size(), 0u);
+    EXPECT_EQ(array.data(), nullptr);
+    EXPECT_EQ(array.begin(), array.end());
+    EXPECT_EQ(array.toVector(), std::vector<double>());
+    EXPECT_FALSE(array.isSharedWith(array));
+}
+
+TEST_F(DoubleArrayTest, fromVector)
+{
+    const std::vector<double> expected = {1.0, 2.0, 3.0};
+    DoubleArray array(expected);
+
+    EXPECT_FALSE(array.empty());
+    EXPECT_EQ(array.size(), 3u);
+    EXPECT_EQ(array[1], 2.0);
+    EXPECT_EQ(std::vector<double>(array.begin(), array.end()), expected);
+    EXPECT_EQ(array.toVector(), expected);
+}
+
+//! Copies share the buffer until one of them is modified.
+
+TEST_F(DoubleArrayTest, copyOnWrite)
+{
+    DoubleArray array(std::vector<double>{1.0, 2.0, 3.0});
+    DoubleArray copy = array;
+    EXPECT_TRUE(copy.isSharedWith(array));
+    EXPECT_EQ(copy.data(), array.data());
+
+    copy.mutableData()[0] = 42.0;
+    EXPECT_FALSE(copy.isSharedWith(array));
+    EXPECT_EQ(array.toVector(), std::vector<double>({1.0, 2.0, 3.0}));
+    EXPECT_EQ(copy.toVector(), std::vector<double>({42.0, 2.0, 3.0}));
+
+    // not shared buffer is modified in place
+    auto data = copy.data();
+    copy.mutableData()[1] = 43.0;
+    EXPECT_EQ(copy.data(), data);
+}
+
+TEST_F(DoubleArrayTest, comparison)
+{
+    DoubleArray array1(std::vector<double>{1.0, 2.0});
+    DoubleArray array2(std::vector<double>{1.0, 2.0});
+    DoubleArray array3(std::vector<double>{1.0, 3.0});
+
+    EXPECT_TRUE(array1 == array2);
+    EXPECT_FALSE(array1 != array2);
+    EXPECT_TRUE(array1 != array3);
+    EXPECT_TRUE(array1 < array3);
+    EXPECT_FALSE(array3 < array1);
+    EXPECT_TRUE(DoubleArray() == DoubleArray(std::vector<double>()));
+}
+
+//! Variant based on DoubleArray shares the buffer.
+
+TEST_F(DoubleArrayTest, variant)
+{
+    DoubleArray array(std::vector<double>{1.0, 2.0, 3.0});
+    auto variant = Variant::fromValue(array);
+
+    EXPECT_TRUE(Utils::IsDoubleArrayVariant(variant));
+    EXPECT_FALSE(Utils::IsDoubleVectorVariant(variant));
+    EXPECT_TRUE(variant.value<DoubleArray>().isSharedWith(array));
+    EXPECT_TRUE(Utils::toDoubleArray(variant).isSharedWith(array));
+
+    // arrays of double are compatible with each other
+    auto vector_variant = Variant::fromValue(std::vector<double>{1.0, 2.0, 3.0});
+    EXPECT_TRUE(Utils::CompatibleVariantTypes(variant, vector_variant));
+    EXPECT_TRUE(Utils::CompatibleVariantTypes(vector_variant, variant));
+    EXPECT_FALSE(Utils::IsTheSame(variant, vector_variant));
+    EXPECT_FALSE(Utils::CompatibleVariantTypes(variant, Variant::fromValue(42.0)));
+    EXPECT_EQ(Utils::toDoubleArray(vector_variant), array);
+}
@@ -10,6 +10,7 @@
 #include "mvvm/commands/insertnewitemcommand.h"
 
 #include "google_test.h"
+#include "mvvm/commands/insertnewitemscommand.h"
 #include "mvvm/interfaces/itemfactoryinterface.h"
 #include "mvvm/model/compounditem.h"
 #include "mvvm/model/itempool.h"
@@ -204,3 +205,23 @@ TEST_F(InsertNewItemCommandTest, insertNewPropertyItemIdInPool)
     EXPECT_EQ(model.findItem(orig_identifier), restored_item);
     EXPECT_EQ(pool->item_for_key(orig_identifier), restored_item);
 }
+
+//! Undo of the range insertion fails without side effects, if inserted items are gone.
+
+TEST_F(InsertNewItemCommandTest, undoRangeOfMissingItems)
+{
+    SessionModel model;
+    auto parent = model.insertItem<SessionItem>();
+    parent->registerTag(TagInfo::universalTag("tag"), /*set_as_default*/ true);
+
+    auto factory_func = [&model]() { return model.factory()->createItem(Constants::BaseType); };
+    InsertNewItemsCommand command(factory_func, parent, TagRow{"tag", 0}, 3);
+    command.execute();
+    EXPECT_EQ(parent->childrenCount(), 3);
+
+    // removing one of inserted items behind the command's back
+    delete parent->takeItem({"tag", 2});
+
+    EXPECT_THROW(command.undo(), std::runtime_error);
+    EXPECT_EQ(parent->childrenCount(), 2);
+}
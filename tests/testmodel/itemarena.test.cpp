@@ -0,0 +1,111 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/model/itemarena.h"
+
+#include "google_test.h"
+#include "mvvm/model/sessionitem.h"
+#include "mvvm/model/sessionitemdata.h"
+#include "mvvm/model/taginfo.h"
+#include <memory>
+
+using namespace ModelView;
+
+//! Testing ItemArena.
+
+class ItemArenaTest : public ::testing::Test {
+};
+
+TEST_F(ItemArenaTest, initialState)
+{
+    ItemArena arena;
+    EXPECT_EQ(arena.blockCount(), 0u);
+    EXPECT_EQ(arena.reservedSize(), 0u);
+    EXPECT_EQ(ItemArena::current(), nullptr);
+}
+
+//! Objects created outside of the scope are allocated on the heap.
+
+TEST_F(ItemArenaTest, heapAllocation)
+{
+    ItemArena arena;
+    auto data = std::make_unique<SessionItemData>();
+    EXPECT_FALSE(ItemArena::isFromArena(data.get(), &arena));
+    EXPECT_EQ(arena.blockCount(), 0u);
+}
+
+TEST_F(ItemArenaTest, scope)
+{
+    ItemArena arena1;
+    ItemArena arena2;
+    {
+        ItemArena::Scope scope1(&arena1);
+        EXPECT_EQ(ItemArena::current(), &arena1);
+        {
+            ItemArena::Scope scope2(&arena2);
+            EXPECT_EQ(ItemArena::current(), &arena2);
+            ItemArena::Scope scope3(nullptr);
+            EXPECT_EQ(ItemArena::current(), nullptr);
+        }
+        EXPECT_EQ(ItemArena::current(), &arena1);
+    }
+    EXPECT_EQ(ItemArena::current(), nullptr);
+}
+
+//! Item and its internal parts are allocated in the arena.
+
+TEST_F(ItemArenaTest, itemAllocation)
+{
+    ItemArena arena;
+    std::unique_ptr<SessionItem> item;
+    {
+        ItemArena::Scope scope(&arena);
+        item = std::make_unique<SessionItem>();
+        item->registerTag(TagInfo::universalTag("tag"), /*set_as_default*/ true);
+        item->insertItem(new SessionItem, TagRow::append());
+    }
+    EXPECT_TRUE(ItemArena::isFromArena(item.get(), &arena));
+    EXPECT_TRUE(ItemArena::isFromArena(item->itemData(), &arena));
+    EXPECT_TRUE(ItemArena::isFromArena(item->getItem("tag"), &arena));
+    EXPECT_GT(arena.blockCount(), 2u);
+    EXPECT_GT(arena.reservedSize(), 0u);
+
+    item.reset();
+    EXPECT_EQ(arena.blockCount(), 0u);
+}
+
+//! Freed blocks are reused.
+
+TEST_F(ItemArenaTest, blockReuse)
+{
+    ItemArena arena;
+    ItemArena::Scope scope(&arena);
+
+    auto data = new SessionItemData;
+    delete data;
+    auto reused = new SessionItemData;
+    EXPECT_EQ(reused, data);
+    delete reused;
+}
+
+//! Items can outlive the arena.
+
+TEST_F(ItemArenaTest, itemOutlivesArena)
+{
+    std::unique_ptr<SessionItem> item;
+    {
+        ItemArena arena;
+        ItemArena::Scope scope(&arena);
+        item = std::make_unique<SessionItem>();
+    }
+    EXPECT_EQ(ItemArena::current(), nullptr);
+    item->setDisplayName("abc");
+    EXPECT_EQ(item->displayName(), "abc");
+    item.reset();
+}
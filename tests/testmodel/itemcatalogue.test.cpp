@@ -20,6 +20,12 @@ using namespace ModelView;
 //! Testing ItemCatalogue construction
 
 class ItemCatalogueTest : public ::testing::Test {
+public:
+    //! Item derived from the type with stamp constructor, without declaring its own.
+    class TestItem : public VectorItem {
+    public:
+        TestItem() { setData(std::string("TestItem"), ItemDataRole::DISPLAY); }
+    };
 };
 
 TEST_F(ItemCatalogueTest, initialState)
@@ -159,3 +165,111 @@ TEST_F(ItemCatalogueTest, merge)
     // duplications is not allowed
     EXPECT_THROW(catalogue1.merge(catalogue2), std::runtime_error);
 }
+
+//! Creation of items out of prototypes.
+
+TEST_F(ItemCatalogueTest, prototypeMode)
+{
+    ItemCatalogue catalogue;
+    catalogue.registerItem<PropertyItem>();
+    catalogue.registerItem<VectorItem>();
+    EXPECT_FALSE(catalogue.prototypeMode());
+
+    catalogue.setPrototypeMode(true);
+    EXPECT_TRUE(catalogue.prototypeMode());
+
+    auto item1 = catalogue.create(Constants::VectorItemType);
+    auto item2 = catalogue.create(Constants::VectorItemType);
+    auto vector = dynamic_cast<VectorItem*>(item2.get());
+    ASSERT_TRUE(vector != nullptr);
+
+    // stamped item has same layout as the prototype, but own identifiers
+    EXPECT_EQ(vector->childrenCount(), 3);
+    EXPECT_EQ(vector->displayName(), item1->displayName());
+    EXPECT_NE(vector->identifier(), item1->identifier());
+    EXPECT_EQ(vector->getItem(VectorItem::P_Y)->displayName(), "Y");
+    EXPECT_EQ(vector->getItem(VectorItem::P_Y)->parent(), vector);
+    EXPECT_NE(vector->getItem(VectorItem::P_Y)->identifier(),
+              item1->getItem(VectorItem::P_Y)->identifier());
+    EXPECT_TRUE(dynamic_cast<PropertyItem*>(vector->getItem(VectorItem::P_Y)) != nullptr);
+
+    // stamped items are independent
+    vector->setY(42.0);
+    EXPECT_EQ(vector->y(), 42.0);
+    EXPECT_EQ(catalogue.create(Constants::VectorItemType)->property<double>(VectorItem::P_Y), 0.0);
+
+    // copy of the catalogue keeps the mode
+    ItemCatalogue copy(catalogue);
+    EXPECT_TRUE(copy.prototypeMode());
+    EXPECT_EQ(copy.create(Constants::VectorItemType)->childrenCount(), 3);
+}
+
+//! Items with children of types unknown to the catalogue are created by factory functions.
+
+TEST_F(ItemCatalogueTest, prototypeModeFallback)
+{
+    ItemCatalogue catalogue;
+    catalogue.registerItem<VectorItem>();
+    catalogue.setPrototypeMode(true);
+
+    // PropertyItem is not registered, vector can't be stamped
+    auto item = catalogue.create(Constants::VectorItemType);
+    EXPECT_TRUE(dynamic_cast<VectorItem*>(item.get()) != nullptr);
+    EXPECT_EQ(item->childrenCount(), 3);
+}
+
+//! Only types declaring stamp constructor are stamped out of prototypes.
+
+TEST_F(ItemCatalogueTest, prototypeModeOptIn)
+{
+    static_assert(!std::is_copy_constructible_v<SessionItem>);
+    static_assert(!std::is_copy_constructible_v<VectorItem>);
+    static_assert(!std::is_copy_constructible_v<TestItem>);
+
+    ItemCatalogue catalogue;
+    catalogue.registerItem<PropertyItem>();
+    catalogue.registerItem<TestItem>();
+    catalogue.setPrototypeMode(true);
+
+    // TestItem has no stamp constructor, items are created by the factory function
+    auto item = catalogue.create(Constants::VectorItemType);
+    EXPECT_TRUE(dynamic_cast<TestItem*>(item.get()) != nullptr);
+    EXPECT_EQ(item->displayName(), "TestItem");
+    EXPECT_EQ(catalogue.clone(*item, /*preserve_identifiers*/ false), nullptr);
+}
+
+//! Native deep copy of existing item.
+
+TEST_F(ItemCatalogueTest, clone)
+{
+    ItemCatalogue catalogue;
+    catalogue.registerItem<PropertyItem>();
+    catalogue.registerItem<VectorItem>();
+
+    VectorItem item;
+    item.setY(42.0);
+    item.setDisplayName("abc");
+
+    // copy gets new identifiers
+    auto copy = catalogue.clone(item, /*preserve_identifiers*/ false);
+    auto vector = dynamic_cast<VectorItem*>(copy.get());
+    ASSERT_TRUE(vector != nullptr);
+    EXPECT_EQ(vector->displayName(), "abc");
+    EXPECT_EQ(vector->y(), 42.0);
+    EXPECT_NE(vector->identifier(), item.identifier());
+    EXPECT_NE(vector->getItem(VectorItem::P_Y)->identifier(),
+              item.getItem(VectorItem::P_Y)->identifier());
+    EXPECT_EQ(vector->getItem(VectorItem::P_Y)->parent(), vector);
+
+    // clone keeps identifiers
+    auto clone = catalogue.clone(item, /*preserve_identifiers*/ true);
+    EXPECT_EQ(clone->identifier(), item.identifier());
+    EXPECT_EQ(clone->getItem(VectorItem::P_Y)->identifier(),
+              item.getItem(VectorItem::P_Y)->identifier());
+    EXPECT_EQ(clone->property<double>(VectorItem::P_Y), 42.0);
+
+    // PropertyItem is not registered in the second catalogue, vector can't be copied natively
+    ItemCatalogue catalogue2;
+    catalogue2.registerItem<VectorItem>();
+    EXPECT_EQ(catalogue2.clone(item, /*preserve_identifiers*/ false), nullptr);
+}
@@ -84,6 +84,29 @@ TEST_F(ItemListenerTest, unsubscribeScenario)
     EXPECT_EQ(controller->ondata_change_call_count, 1);
 }
 
+//! Disconnection of single callback using the handle returned on subscription.
+
+TEST_F(ItemListenerTest, disconnect)
+{
+    SessionModel model;
+    auto item = model.insertItem<PropertyItem>();
+
+    auto controller = std::make_unique<TestController>();
+    controller->setItem(item);
+
+    size_t call_count{0};
+    auto connection =
+        controller->setOnDataChange([&call_count](SessionItem*, int) { call_count++; });
+    item->setData(42.0);
+    EXPECT_EQ(call_count, 1);
+    EXPECT_EQ(controller->ondata_change_call_count, 1);
+
+    controller->disconnect(connection);
+    item->setData(43.0);
+    EXPECT_EQ(call_count, 1);
+    EXPECT_EQ(controller->ondata_change_call_count, 2);
+}
+
 //! Checks that controller can be deleted before item.
 
 TEST_F(ItemListenerTest, controllerDeletedBeforeItem)
@@ -10,7 +10,11 @@
 #include "mvvm/model/itemmanager.h"
 
 #include "google_test.h"
+#include "mvvm/interfaces/itemfactoryinterface.h"
+#include "mvvm/model/itemarena.h"
 #include "mvvm/model/itempool.h"
+#include "mvvm/model/propertyitem.h"
+#include "mvvm/model/sessionitem.h"
 #include <memory>
 
 using namespace ModelView;
@@ -30,3 +34,70 @@ TEST_F(ItemManagerTest, initialState)
     EXPECT_EQ(manager.itemPool(), pool.get());
     EXPECT_EQ(manager.itemPool()->size(), 0);
 }
+
+//! Items created by the manager, or by its factory, are allocated in the arena.
+
+TEST_F(ItemManagerTest, itemArena)
+{
+    ItemManager manager;
+    EXPECT_EQ(manager.itemArena(), nullptr);
+    EXPECT_FALSE(ItemArena::isFromArena(manager.createItem().get(), manager.itemArena()));
+
+    auto arena = std::make_shared<ItemArena>();
+    manager.setItemArena(arena);
+    EXPECT_EQ(manager.itemArena(), arena.get());
+
+    auto item1 = manager.createItem();
+    auto item2 = manager.factory()->createItem(Constants::PropertyType);
+    auto item3 = manager.createItem([]() { return std::make_unique<SessionItem>(); });
+    auto root = manager.createRootItem();
+    EXPECT_TRUE(ItemArena::isFromArena(item1.get(), arena.get()));
+    EXPECT_TRUE(ItemArena::isFromArena(item2.get(), arena.get()));
+    EXPECT_TRUE(ItemArena::isFromArena(item3.get(), arena.get()));
+    EXPECT_TRUE(ItemArena::isFromArena(root.get(), arena.get()));
+    EXPECT_EQ(ItemArena::current(), nullptr);
+
+    manager.setItemArena({});
+    EXPECT_EQ(manager.itemArena(), nullptr);
+    EXPECT_FALSE(ItemArena::isFromArena(manager.createItem().get(), arena.get()));
+}
+
+//! Const and non-const access to the factory give the same arena-aware factory.
+
+TEST_F(ItemManagerTest, factoryWithArena)
+{
+    ItemManager manager;
+    const ItemManager& const_manager = manager;
+    EXPECT_EQ(manager.factory(), const_manager.factory());
+
+    manager.setItemArena(std::make_shared<ItemArena>());
+    EXPECT_EQ(manager.factory(), const_manager.factory());
+    EXPECT_TRUE(ItemArena::isFromArena(manager.factory()->createItem(Constants::PropertyType).get(),
+                                       manager.itemArena()));
+
+    // native copies are allocated in the arena too
+    PropertyItem property;
+    auto copy = manager.factory()->cloneItem(property, /*preserve_identifiers*/ false);
+    ASSERT_TRUE(copy != nullptr);
+    EXPECT_TRUE(ItemArena::isFromArena(copy.get(), manager.itemArena()));
+}
+
+//! Arena is replaced only if it isn't shared.
+
+TEST_F(ItemManagerTest, resetItemArena)
+{
+    ItemManager manager;
+    EXPECT_FALSE(manager.resetItemArena());
+
+    manager.setItemArena(std::make_shared<ItemArena>());
+    auto item = manager.createItem();
+    EXPECT_TRUE(manager.resetItemArena());
+    EXPECT_NE(manager.itemArena(), nullptr);
+    EXPECT_TRUE(ItemArena::isFromArena(manager.createItem().get(), manager.itemArena()));
+    item.reset(); // last block of the old arena is released
+
+    auto shared_arena = std::make_shared<ItemArena>();
+    manager.setItemArena(shared_arena);
+    EXPECT_FALSE(manager.resetItemArena());
+    EXPECT_EQ(manager.itemArena(), shared_arena.get());
+}
@@ -244,3 +244,54 @@ TEST(ItemMapperTest, onAboutToRemoveItem)
     // perform action
     model.removeItem(compound1, expected_tagrow);
 }
+
+//! Changing property of the great-grandchild. Mapper of the top item shouldn't be notified.
+
+TEST(ItemMapperTest, onGreatGrandchildPropertyChange)
+{
+    SessionModel model;
+    auto compound1 = model.insertItem<CompoundItem>();
+    compound1->registerTag(TagInfo::universalTag("tag1"), /*set_as_default*/ true);
+    auto compound2 = model.insertItem<CompoundItem>(compound1);
+    compound2->registerTag(TagInfo::universalTag("tag2"), /*set_as_default*/ true);
+    auto compound3 = model.insertItem<CompoundItem>(compound2);
+    compound3->addProperty("height", 42.0);
+
+    MockWidgetForItem widget1(compound1);
+    MockWidgetForItem widget2(compound2);
+
+    EXPECT_CALL(widget1, onDataChange(_, _)).Times(0);
+    EXPECT_CALL(widget1, onPropertyChange(_, _)).Times(0);
+    EXPECT_CALL(widget1, onChildPropertyChange(_, _)).Times(0);
+    EXPECT_CALL(widget2, onDataChange(_, _)).Times(0);
+    EXPECT_CALL(widget2, onPropertyChange(_, _)).Times(0);
+    EXPECT_CALL(widget2, onChildPropertyChange(compound3, "height")).Times(1);
+
+    // perform action
+    compound3->setProperty("height", 43.0);
+}
+
+//! Mappers of unrelated items, including the root item, are not notified about the data change.
+
+TEST(ItemMapperTest, unrelatedItems)
+{
+    SessionModel model;
+    auto compound1 = model.insertItem<CompoundItem>();
+    auto compound2 = model.insertItem<CompoundItem>();
+    compound2->addProperty("height", 42.0);
+
+    MockWidgetForItem widget1(compound1);
+    MockWidgetForItem root_widget(model.rootItem());
+
+    EXPECT_CALL(widget1, onDataChange(_, _)).Times(0);
+    EXPECT_CALL(widget1, onPropertyChange(_, _)).Times(0);
+    EXPECT_CALL(widget1, onChildPropertyChange(_, _)).Times(0);
+    EXPECT_CALL(root_widget, onDataChange(_, _)).Times(0);
+    EXPECT_CALL(root_widget, onPropertyChange(_, _)).Times(0);
+    EXPECT_CALL(root_widget, onChildPropertyChange(_, _)).Times(0);
+    EXPECT_CALL(root_widget, onItemInserted(model.rootItem(), TagRow{"rootTag", 2})).Times(1);
+
+    // perform action
+    compound2->setProperty("height", 43.0);
+    model.insertItem<CompoundItem>();
+}
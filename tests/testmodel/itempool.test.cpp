@@ -13,6 +13,7 @@
 #include "mvvm/model/sessionitem.h"
 #include <memory>
 #include <stdexcept>
+#include <vector>
 
 using namespace ModelView;
 
@@ -105,3 +106,51 @@ TEST_F(ItemPoolTest, customKey)
 
     delete item;
 }
+
+//! Custom keys which are not in UUID form are returned exactly as they were registered.
+
+TEST_F(ItemPoolTest, customKeyLookup)
+{
+    ItemPool pool;
+    std::unique_ptr<SessionItem> item1(new SessionItem);
+    std::unique_ptr<SessionItem> item2(new SessionItem);
+
+    EXPECT_EQ(pool.register_item(item1.get(), "abc-cde-fgh"), "abc-cde-fgh");
+    auto key2 = pool.register_item(item2.get());
+
+    EXPECT_EQ(pool.key_for_item(item1.get()), "abc-cde-fgh");
+    EXPECT_EQ(pool.item_for_key("abc-cde-fgh"), item1.get());
+    EXPECT_EQ(pool.item_for_key("abc-cde-fgi"), nullptr);
+    EXPECT_EQ(pool.item_for_id(UniqueId::fromString("abc-cde-fgh")), item1.get());
+    EXPECT_EQ(pool.item_for_id(UniqueId::fromString(key2)), item2.get());
+
+    pool.unregister_item(item1.get());
+    EXPECT_EQ(pool.item_for_key("abc-cde-fgh"), nullptr);
+    EXPECT_EQ(pool.key_for_item(item2.get()), key2);
+}
+
+//! Registration and deregistration of many items, with table growth.
+
+TEST_F(ItemPoolTest, manyItems)
+{
+    ItemPool pool;
+    const int count = 1000;
+    std::vector<std::unique_ptr<SessionItem>> items;
+    std::vector<identifier_type> keys;
+    for (int i = 0; i < count; ++i) {
+        items.emplace_back(std::make_unique<SessionItem>());
+        keys.push_back(pool.register_item(items.back().get()));
+    }
+    EXPECT_EQ(pool.size(), static_cast<size_t>(count));
+
+    // removing every second item
+    for (int i = 0; i < count; i += 2)
+        pool.unregister_item(items[i].get());
+    EXPECT_EQ(pool.size(), static_cast<size_t>(count / 2));
+
+    for (int i = 0; i < count; ++i) {
+        auto expected = i % 2 ? items[i].get() : nullptr;
+        EXPECT_EQ(pool.item_for_key(keys[i]), expected);
+        EXPECT_EQ(pool.key_for_item(items[i].get()), i % 2 ? keys[i] : identifier_type());
+    }
+}
@@ -0,0 +1,78 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/model/itemrange.h"
+
+#include "google_test.h"
+#include "mvvm/model/sessionitem.h"
+#include "mvvm/model/taginfo.h"
+#include <stdexcept>
+
+using namespace ModelView;
+
+//! Tests for ItemRange class.
+
+class ItemRangeTest : public ::testing::Test {
+};
+
+TEST_F(ItemRangeTest, initialState)
+{
+    ItemRange range;
+    EXPECT_TRUE(range.empty());
+    EXPECT_EQ(range.size(), 0);
+    EXPECT_TRUE(range.toVector().empty());
+
+    SessionItem item;
+    EXPECT_TRUE(item.childrenRange().empty());
+    EXPECT_EQ(item.childrenRange().begin(), item.childrenRange().end());
+    EXPECT_EQ(item.childrenCount(), 0);
+}
+
+//! Iteration over children of several tags, including empty ones.
+
+TEST_F(ItemRangeTest, childrenRange)
+{
+    SessionItem parent;
+    parent.registerTag(TagInfo::universalTag("empty1"));
+    parent.registerTag(TagInfo::universalTag("tag1"), /*set_as_default*/ true);
+    parent.registerTag(TagInfo::universalTag("empty2"));
+    parent.registerTag(TagInfo::universalTag("tag2"));
+    parent.registerTag(TagInfo::universalTag("empty3"));
+
+    auto child1 = new SessionItem;
+    auto child2 = new SessionItem;
+    auto child3 = new SessionItem;
+    parent.insertItem(child1, TagRow::append("tag1"));
+    parent.insertItem(child2, TagRow::append("tag1"));
+    parent.insertItem(child3, TagRow::append("tag2"));
+
+    std::vector<SessionItem*> expected = {child1, child2, child3};
+    std::vector<SessionItem*> visited;
+    for (auto child : parent.childrenRange())
+        visited.push_back(child);
+    EXPECT_EQ(visited, expected);
+    EXPECT_EQ(parent.childrenRange().toVector(), expected);
+    EXPECT_EQ(parent.children(), expected);
+    EXPECT_EQ(parent.childrenRange().size(), 3);
+    EXPECT_EQ(parent.childrenCount(), 3);
+
+    // single tag
+    expected = {child1, child2};
+    EXPECT_EQ(parent.childrenRange("tag1").toVector(), expected);
+    EXPECT_EQ(parent.childrenRange("").toVector(), expected); // default tag
+    expected = {child3};
+    EXPECT_EQ(parent.childrenRange("tag2").toVector(), expected);
+    EXPECT_TRUE(parent.childrenRange("empty3").empty());
+    EXPECT_THROW(parent.childrenRange("non-existing"), std::runtime_error);
+
+    // post-increment
+    auto it = parent.childrenRange().begin();
+    EXPECT_EQ(*it++, child1);
+    EXPECT_EQ(*it, child2);
+}
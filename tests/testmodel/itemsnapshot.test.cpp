@@ -0,0 +1,133 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/model/itemsnapshot.h"
+
+#include "google_test.h"
+#include "mvvm/model/itemsnapshotcache.h"
+#include "mvvm/model/sessionmodel.h"
+#include "mvvm/standarditems/vectoritem.h"
+#include <stdexcept>
+#include <thread>
+
+using namespace ModelView;
+
+//! Testing ItemSnapshot and ItemSnapshotCache.
+
+class ItemSnapshotTest : public ::testing::Test {
+};
+
+TEST_F(ItemSnapshotTest, content)
+{
+    SessionModel model;
+    auto vector = model.insertItem<VectorItem>();
+    vector->setProperty(VectorItem::P_X, 1.0);
+    vector->setProperty(VectorItem::P_Z, 3.0);
+
+    auto snapshot = ItemSnapshot::create(vector);
+    EXPECT_EQ(snapshot->modelType(), vector->modelType());
+    EXPECT_EQ(snapshot->identifier(), vector->identifier());
+    EXPECT_EQ(snapshot->displayName(), vector->displayName());
+    EXPECT_EQ(snapshot->childrenCount(), 3);
+    EXPECT_EQ(snapshot->itemCount(VectorItem::P_Y), 1);
+    EXPECT_EQ(snapshot->property<double>(VectorItem::P_X), 1.0);
+    EXPECT_EQ(snapshot->property<double>(VectorItem::P_Z), 3.0);
+    EXPECT_EQ(snapshot->getItem(VectorItem::P_Y)->identifier(),
+              vector->getItem(VectorItem::P_Y)->identifier());
+    EXPECT_EQ(snapshot->getItem("unexisting"), nullptr);
+    EXPECT_FALSE(snapshot->hasData(ItemDataRole::DATA));
+
+    // snapshot doesn't change together with the item
+    vector->setProperty(VectorItem::P_X, 42.0);
+    EXPECT_EQ(snapshot->property<double>(VectorItem::P_X), 1.0);
+}
+
+//! Consecutive snapshots share unchanged branches.
+
+TEST_F(ItemSnapshotTest, structuralSharing)
+{
+    SessionModel model;
+    auto vector0 = model.insertItem<VectorItem>();
+    auto vector1 = model.insertItem<VectorItem>();
+    ItemSnapshotCache cache(&model);
+
+    auto snapshot1 = cache.snapshot();
+    EXPECT_EQ(snapshot1->childrenCount(), 2);
+    EXPECT_EQ(cache.snapshot(), snapshot1);
+    EXPECT_EQ(cache.size(), 9);
+
+    vector1->setProperty(VectorItem::P_Y, 42.0);
+    auto snapshot2 = cache.snapshot();
+    EXPECT_NE(snapshot2, snapshot1);
+    EXPECT_EQ(snapshot2->getItem("", 0), snapshot1->getItem("", 0));
+    EXPECT_NE(snapshot2->getItem("", 1), snapshot1->getItem("", 1));
+    EXPECT_EQ(snapshot2->getItem("", 1)->getItem(VectorItem::P_X),
+              snapshot1->getItem("", 1)->getItem(VectorItem::P_X));
+    EXPECT_EQ(snapshot2->getItem("", 1)->property<double>(VectorItem::P_Y), 42.0);
+    EXPECT_EQ(snapshot1->getItem("", 1)->property<double>(VectorItem::P_Y), 0.0);
+
+    // snapshot of the subtree is shared with the snapshot of the whole model
+    EXPECT_EQ(cache.snapshot(vector0).get(), snapshot2->getItem("", 0));
+}
+
+//! Insertion and removal of items are reflected in the next snapshot.
+
+TEST_F(ItemSnapshotTest, insertRemove)
+{
+    SessionModel model;
+    auto vector = model.insertItem<VectorItem>();
+    ItemSnapshotCache cache(&model);
+    auto snapshot1 = cache.snapshot();
+
+    model.insertItem<VectorItem>();
+    auto snapshot2 = cache.snapshot();
+    EXPECT_EQ(snapshot1->childrenCount(), 1);
+    EXPECT_EQ(snapshot2->childrenCount(), 2);
+    EXPECT_EQ(snapshot2->getItem("", 0), snapshot1->getItem("", 0));
+
+    model.removeItem(model.rootItem(), {"", 0});
+    auto snapshot3 = cache.snapshot();
+    EXPECT_EQ(snapshot3->childrenCount(), 1);
+    EXPECT_EQ(snapshot3->getItem("", 0), snapshot2->getItem("", 1));
+    EXPECT_EQ(cache.size(), 5);
+    EXPECT_EQ(snapshot1->getItem("", 0)->identifier(), vector->identifier());
+
+    model.clear();
+    EXPECT_EQ(cache.size(), 0);
+    EXPECT_EQ(cache.snapshot()->childrenCount(), 0);
+
+    SessionModel other_model;
+    EXPECT_THROW(cache.snapshot(other_model.rootItem()), std::runtime_error);
+}
+
+//! Snapshots are read from worker threads while the model is being edited.
+
+TEST_F(ItemSnapshotTest, concurrentReading)
+{
+    SessionModel model;
+    auto vector = model.insertItem<VectorItem>();
+    ItemSnapshotCache cache(&model);
+
+    const int n_snapshots = 100;
+    std::vector<std::thread> workers;
+    std::vector<double> results(n_snapshots, 0.0);
+    for (int index = 0; index < n_snapshots; ++index) {
+        vector->setProperty(VectorItem::P_X, static_cast<double>(index));
+        auto snapshot = cache.snapshot();
+        workers.emplace_back([snapshot, &results, index]() {
+            results[static_cast<size_t>(index)] =
+                snapshot->getItem("", 0)->property<double>(VectorItem::P_X);
+        });
+    }
+    for (auto& worker : workers)
+        worker.join();
+
+    for (int index = 0; index < n_snapshots; ++index)
+        EXPECT_EQ(results[static_cast<size_t>(index)], static_cast<double>(index));
+}
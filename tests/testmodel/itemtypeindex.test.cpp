@@ -0,0 +1,101 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/model/itemtypeindex.h"
+
+#include "google_test.h"
+#include "mvvm/model/compounditem.h"
+#include "mvvm/model/propertyitem.h"
+#include "mvvm/model/sessionmodel.h"
+#include "mvvm/standarditems/containeritem.h"
+#include "mvvm/standarditems/vectoritem.h"
+
+using namespace ModelView;
+
+//! Tests for ItemTypeIndex class, and its usage by SessionModel.
+
+class ItemTypeIndexTest : public ::testing::Test {
+};
+
+TEST_F(ItemTypeIndexTest, initialState)
+{
+    ItemTypeIndex index;
+    EXPECT_EQ(index.size(), 0);
+    EXPECT_TRUE(index.findItems(Constants::PropertyType).empty());
+    EXPECT_TRUE(index.findItems([](const SessionItem*) { return true; }).empty());
+}
+
+//! Items are found by model type and by C++ type, in the order of tree traversal.
+
+TEST_F(ItemTypeIndexTest, findItems)
+{
+    SessionModel model;
+    auto container = model.insertItem<ContainerItem>();
+    auto vector1 = model.insertItem<VectorItem>(container);
+    auto compound = model.insertItem<CompoundItem>();
+    auto vector0 = model.insertItem<VectorItem>(container, {"", 0});
+
+    std::vector<VectorItem*> expected_vectors = {vector0, vector1};
+    EXPECT_EQ(model.findItems<VectorItem>(), expected_vectors);
+
+    std::vector<SessionItem*> expected = {vector0, vector1};
+    EXPECT_EQ(model.findItems(VectorItem().modelType()), expected);
+
+    // VectorItem and ContainerItem are derived from CompoundItem
+    std::vector<CompoundItem*> expected_compounds = {container, vector0, vector1, compound};
+    EXPECT_EQ(model.findItems<CompoundItem>(), expected_compounds);
+
+    // properties of vectors
+    EXPECT_EQ(model.findItems<PropertyItem>().size(), 6);
+    EXPECT_EQ(model.findItems<PropertyItem>().front(), vector0->getItem(VectorItem::P_X));
+
+    // all items
+    EXPECT_EQ(model.findItems<>().size(), 11);
+    EXPECT_EQ(model.findItems<>().front(), model.rootItem());
+}
+
+//! Removed items disappear from the index.
+
+TEST_F(ItemTypeIndexTest, removeItems)
+{
+    SessionModel model;
+    auto vector0 = model.insertItem<VectorItem>();
+    model.insertItem<VectorItem>();
+    auto vector2 = model.insertItem<VectorItem>();
+
+    model.removeItem(model.rootItem(), {"", 1});
+    std::vector<VectorItem*> expected = {vector0, vector2};
+    EXPECT_EQ(model.findItems<VectorItem>(), expected);
+    EXPECT_EQ(model.findItems<PropertyItem>().size(), 6);
+
+    model.clear();
+    EXPECT_TRUE(model.findItems<VectorItem>().empty());
+    EXPECT_EQ(model.findItems<>().size(), 1);
+}
+
+//! Order of found items follows structural changes made after the previous query.
+
+TEST_F(ItemTypeIndexTest, orderAfterMove)
+{
+    SessionModel model;
+    auto vector0 = model.insertItem<VectorItem>();
+    auto vector1 = model.insertItem<VectorItem>();
+    auto vector2 = model.insertItem<VectorItem>();
+
+    std::vector<VectorItem*> expected = {vector0, vector1, vector2};
+    EXPECT_EQ(model.findItems<VectorItem>(), expected);
+
+    model.moveItem(vector2, model.rootItem(), {"", 0});
+    expected = {vector2, vector0, vector1};
+    EXPECT_EQ(model.findItems<VectorItem>(), expected);
+
+    auto vector3 = model.insertItem<VectorItem>(model.rootItem(), {"", 1});
+    expected = {vector2, vector3, vector0, vector1};
+    EXPECT_EQ(model.findItems<VectorItem>(), expected);
+}
@@ -195,6 +195,26 @@ TEST_F(JsonVariantConverterTest, vectorOfDoubleVariant)
     EXPECT_EQ(variant, reco_variant);
 }
 
+//! QVariant(DoubleArray) conversion.
+
+TEST_F(JsonVariantConverterTest, doubleArrayVariant)
+{
+    JsonVariantConverter converter;
+
+    const DoubleArray value(std::vector<double>{42.0, 43.0, 44.0});
+    QVariant variant = QVariant::fromValue(value);
+
+    // from variant to json object
+    auto object = converter.get_json(variant);
+    EXPECT_TRUE(converter.isVariant(object));
+
+    // from json object to variant
+    QVariant reco_variant = converter.get_variant(object);
+    EXPECT_TRUE(Utils::IsDoubleArrayVariant(reco_variant));
+    EXPECT_EQ(reco_variant.value<DoubleArray>(), value);
+    EXPECT_EQ(variant, reco_variant);
+}
+
 //! QVariant(ComboProperty) conversion.
 
 TEST_F(JsonVariantConverterTest, comboPropertyVariant)
@@ -125,3 +125,24 @@ TEST_F(ModelHasChangedControllerTest, timeOfLife)
     model.insertItem<PropertyItem>();
     EXPECT_EQ(change_count, 1);
 }
+
+//! Client is informed only once about changes made during the batch.
+
+TEST_F(ModelHasChangedControllerTest, batch)
+{
+    int change_count{0};
+    auto on_change = [&change_count]() { change_count++; };
+
+    SessionModel model;
+    ModelHasChangedController controller(&model, on_change);
+
+    model.beginBatch();
+    auto item = model.insertItem<PropertyItem>();
+    item->setData(42.0);
+    model.insertItem<PropertyItem>();
+    EXPECT_TRUE(controller.hasChanged());
+    EXPECT_EQ(change_count, 0);
+
+    model.endBatch();
+    EXPECT_EQ(change_count, 1);
+}
@@ -50,6 +50,31 @@ TEST_F(ModelListenerTest, onDataChange)
     EXPECT_EQ(counter, 1);
 }
 
+//! Disconnection of single callback using the handle returned on subscription.
+
+TEST_F(ModelListenerTest, disconnect)
+{
+    SessionModel model;
+    TestListener listener(&model);
+
+    int counter1{0};
+    int counter2{0};
+    auto connection =
+        listener.setOnDataChange([&counter1](SessionItem*, int) { counter1++; });
+    listener.setOnDataChange([&counter2](SessionItem*, int) { counter2++; });
+    EXPECT_TRUE(connection.isValid());
+
+    auto item = model.insertItem<PropertyItem>();
+    item->setData(42.0);
+    EXPECT_EQ(counter1, 1);
+    EXPECT_EQ(counter2, 1);
+
+    listener.disconnect(connection);
+    item->setData(43.0);
+    EXPECT_EQ(counter1, 1);
+    EXPECT_EQ(counter2, 2);
+}
+
 //! Check that controller aware of item deletion.
 
 TEST_F(ModelListenerTest, modelDeletedBeforeListener)
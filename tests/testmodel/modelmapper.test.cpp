@@ -14,7 +14,10 @@
 #include "mvvm/model/sessionitem.h"
 #include "mvvm/model/sessionitemtags.h"
 #include "mvvm/model/sessionmodel.h"
+#include "mvvm/model/taginfo.h"
 #include "mvvm/model/tagrow.h"
+#include <stdexcept>
+#include <vector>
 
 using namespace ModelView;
 using ::testing::_;
@@ -220,3 +223,182 @@ TEST(ModelMapperTest, onClearRebuild)
     auto rebuild = [](auto item) { item->insertItem(new SessionItem, TagRow::append()); };
     model->clear(rebuild);
 }
+
+//! Data changes made inside the batch are delivered once per (item, role) when the batch ends.
+
+TEST(ModelMapperTest, batchDataChange)
+{
+    SessionModel model;
+    auto item = model.insertItem<SessionItem>();
+
+    std::vector<std::pair<SessionItem*, int>> changes;
+    int batch_finished{0};
+    model.mapper()->setOnDataChange(
+        [&changes](SessionItem* item, int role) { changes.emplace_back(item, role); }, &changes);
+    model.mapper()->setOnBatchFinished([&batch_finished](auto) { ++batch_finished; }, &changes);
+
+    model.beginBatch();
+    EXPECT_TRUE(model.mapper()->isBatching());
+    item->setData(42.0);
+    item->setData(43.0);
+    model.beginBatch(); // nested batch
+    item->setData(44.0);
+    item->setData(std::string("abc"), ItemDataRole::DISPLAY);
+    model.endBatch();
+    EXPECT_TRUE(changes.empty());
+    EXPECT_EQ(batch_finished, 0);
+
+    model.endBatch();
+    EXPECT_FALSE(model.mapper()->isBatching());
+    std::vector<std::pair<SessionItem*, int>> expected = {{item, ItemDataRole::DATA},
+                                                          {item, ItemDataRole::DISPLAY}};
+    EXPECT_EQ(changes, expected);
+    EXPECT_EQ(batch_finished, 1);
+
+    EXPECT_THROW(model.endBatch(), std::runtime_error);
+}
+
+//! Adjacent insertions inside the batch are merged into single range.
+
+TEST(ModelMapperTest, batchInsertRange)
+{
+    SessionModel model;
+    auto parent = model.insertItem<SessionItem>();
+    parent->registerTag(TagInfo::universalTag("tag"), /*set_as_default*/ true);
+    model.insertItem<SessionItem>(parent);
+
+    std::vector<TagRow> inserted;
+    std::vector<std::pair<TagRow, int>> ranges;
+    model.mapper()->setOnItemInserted(
+        [&inserted](SessionItem*, const TagRow& tagrow) { inserted.push_back(tagrow); }, &ranges);
+    model.mapper()->setOnItemsInserted(
+        [&ranges](SessionItem*, const TagRow& tagrow, int count) {
+            ranges.emplace_back(tagrow, count);
+        },
+        &ranges);
+
+    model.beginBatch();
+    model.insertItem<SessionItem>(parent, {"tag", 1});
+    model.insertItem<SessionItem>(parent, {"tag", 1});
+    model.insertItem<SessionItem>(parent, {"tag", 3});
+    EXPECT_TRUE(inserted.empty());
+
+    // insertion in front of the range can't be merged
+    model.insertItem<SessionItem>(parent, {"tag", 0});
+    std::vector<std::pair<TagRow, int>> expected_ranges = {{{"tag", 1}, 3}};
+    EXPECT_EQ(ranges, expected_ranges);
+    EXPECT_EQ(inserted, std::vector<TagRow>({{"tag", 1}, {"tag", 2}, {"tag", 3}}));
+
+    model.endBatch();
+    expected_ranges = {{{"tag", 1}, 3}, {{"tag", 0}, 1}};
+    EXPECT_EQ(ranges, expected_ranges);
+    EXPECT_EQ(parent->itemCount("tag"), 5);
+}
+
+//! Adjacent removals inside the batch are merged into single range. Data changes of removed items
+//! are dropped.
+
+TEST(ModelMapperTest, batchRemoveRange)
+{
+    SessionModel model;
+    auto parent = model.insertItem<SessionItem>();
+    parent->registerTag(TagInfo::universalTag("tag"), /*set_as_default*/ true);
+    std::vector<SessionItem*> children;
+    for (int i = 0; i < 4; ++i)
+        children.push_back(model.insertItem<SessionItem>(parent));
+
+    std::vector<SessionItem*> changed;
+    int about_to_remove_count{0};
+    std::vector<std::pair<TagRow, int>> ranges;
+    model.mapper()->setOnDataChange([&changed](SessionItem* item, int) { changed.push_back(item); },
+                                    &ranges);
+    model.mapper()->setOnAboutToRemoveItem(
+        [&about_to_remove_count](SessionItem*, const TagRow&) { ++about_to_remove_count; },
+        &ranges);
+    model.mapper()->setOnItemsRemoved(
+        [&ranges](SessionItem*, const TagRow& tagrow, int count) {
+            ranges.emplace_back(tagrow, count);
+        },
+        &ranges);
+
+    model.beginBatch();
+    children[1]->setData(42.0);
+    children[3]->setData(42.0);
+    model.removeItem(parent, {"tag", 2});
+    model.removeItem(parent, {"tag", 1});
+    EXPECT_EQ(about_to_remove_count, 2);
+    EXPECT_TRUE(ranges.empty());
+
+    model.endBatch();
+    std::vector<std::pair<TagRow, int>> expected_ranges = {{{"tag", 1}, 2}};
+    EXPECT_EQ(ranges, expected_ranges);
+    EXPECT_EQ(changed, std::vector<SessionItem*>({children[3]}));
+}
+
+//! Batch is closed even if a callback throws while collected notifications are delivered.
+
+TEST(ModelMapperTest, batchFlushThrows)
+{
+    SessionModel model;
+    auto item0 = model.insertItem<SessionItem>();
+    auto item1 = model.insertItem<SessionItem>();
+
+    std::vector<SessionItem*> changed;
+    bool throw_on_change{true};
+    model.mapper()->setOnDataChange(
+        [&changed, &throw_on_change](SessionItem* item, int) {
+            changed.push_back(item);
+            if (throw_on_change)
+                throw std::runtime_error("error in callback");
+        },
+        &changed);
+
+    model.beginBatch();
+    item0->setData(42.0);
+    item1->setData(42.0);
+    EXPECT_THROW(model.endBatch(), std::runtime_error);
+    EXPECT_FALSE(model.mapper()->isBatching());
+    EXPECT_EQ(changed, std::vector<SessionItem*>({item0})); // rest of the batch is dropped
+
+    // notifications are delivered immediately again
+    throw_on_change = false;
+    item1->setData(43.0);
+    EXPECT_EQ(changed, std::vector<SessionItem*>({item0, item1}));
+    EXPECT_THROW(model.endBatch(), std::runtime_error);
+}
+
+//! Aborted batch is closed without delivering its notifications. Notifications of the aborted
+//! nested batch are delivered with the enclosing batch.
+
+TEST(ModelMapperTest, abortBatch)
+{
+    SessionModel model;
+    auto item0 = model.insertItem<SessionItem>();
+    auto item1 = model.insertItem<SessionItem>();
+
+    std::vector<SessionItem*> changed;
+    model.mapper()->setOnDataChange([&changed](SessionItem* item, int) { changed.push_back(item); },
+                                    &changed);
+
+    model.beginBatch();
+    item0->setData(42.0);
+    model.beginBatch(); // nested batch
+    item1->setData(42.0);
+    model.abortBatch();
+    EXPECT_TRUE(model.mapper()->isBatching());
+    EXPECT_TRUE(changed.empty());
+    model.endBatch();
+    EXPECT_EQ(changed, std::vector<SessionItem*>({item0, item1}));
+
+    changed.clear();
+    model.beginBatch();
+    item0->setData(43.0);
+    model.abortBatch();
+    EXPECT_FALSE(model.mapper()->isBatching());
+    EXPECT_TRUE(changed.empty());
+
+    // aborting without a batch does nothing
+    model.abortBatch();
+    item1->setData(43.0);
+    EXPECT_EQ(changed, std::vector<SessionItem*>({item1}));
+}
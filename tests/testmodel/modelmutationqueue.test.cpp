@@ -0,0 +1,146 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/model/modelmutationqueue.h"
+
+#include "google_test.h"
+#include "mvvm/model/modelutils.h"
+#include "mvvm/model/path.h"
+#include "mvvm/model/sessionmodel.h"
+#include "mvvm/model/tagrow.h"
+#include "mvvm/signals/modelmapper.h"
+#include "mvvm/standarditems/vectoritem.h"
+#include <thread>
+
+using namespace ModelView;
+
+//! Testing ModelMutationQueue.
+
+class ModelMutationQueueTest : public ::testing::Test {
+};
+
+TEST_F(ModelMutationQueueTest, initialState)
+{
+    SessionModel model;
+    ModelMutationQueue queue(&model);
+    EXPECT_EQ(queue.pendingCount(), 0);
+    EXPECT_EQ(queue.process(), 0);
+}
+
+//! Repeated writes to the same item and role are coalesced and applied in a single batch.
+
+TEST_F(ModelMutationQueueTest, coalescedData)
+{
+    SessionModel model;
+    auto vector = model.insertItem<VectorItem>();
+    auto x = vector->getItem(VectorItem::P_X);
+    auto y = vector->getItem(VectorItem::P_Y);
+
+    int data_change_count{0};
+    int batch_count{0};
+    model.mapper()->setOnDataChange([&](SessionItem*, int) { ++data_change_count; }, nullptr);
+    model.mapper()->setOnBatchFinished([&](SessionModel*) { ++batch_count; }, nullptr);
+
+    ModelMutationQueue queue(&model);
+    queue.postData(x->identifier(), 1.0);
+    queue.postData(Utils::PathFromItem(y), 2.0);
+    queue.postData(x->identifier(), 3.0);
+    queue.postData(Utils::PathFromItem(y), 4.0);
+    EXPECT_EQ(queue.pendingCount(), 2);
+
+    EXPECT_EQ(queue.process(), 2);
+    EXPECT_EQ(vector->property<double>(VectorItem::P_X), 3.0);
+    EXPECT_EQ(vector->property<double>(VectorItem::P_Y), 4.0);
+    EXPECT_EQ(data_change_count, 2);
+    EXPECT_EQ(batch_count, 1);
+    EXPECT_EQ(queue.pendingCount(), 0);
+}
+
+//! Writes are not coalesced across insertion and removal.
+
+TEST_F(ModelMutationQueueTest, structuralChanges)
+{
+    SessionModel model;
+    auto vector = model.insertItem<VectorItem>();
+    auto x_identifier = vector->getItem(VectorItem::P_X)->identifier();
+
+    ModelMutationQueue queue(&model);
+    queue.postData(x_identifier, 1.0);
+    queue.postInsert(model.rootItem()->identifier(), Constants::VectorItemType, TagRow::append());
+    queue.postData(x_identifier, 2.0);
+    queue.postRemove(vector->identifier());
+    queue.postData(x_identifier, 3.0);
+    EXPECT_EQ(queue.pendingCount(), 5);
+
+    // bounded processing
+    EXPECT_EQ(queue.process(2), 2);
+    EXPECT_EQ(model.rootItem()->childrenCount(), 2);
+    EXPECT_EQ(vector->property<double>(VectorItem::P_X), 1.0);
+    EXPECT_EQ(queue.pendingCount(), 3);
+
+    // last write is dropped since its target was removed
+    EXPECT_EQ(queue.process(), 2);
+    EXPECT_EQ(model.rootItem()->childrenCount(), 1);
+    EXPECT_EQ(model.findItem(x_identifier), nullptr);
+}
+
+//! Change rejected by the model is reported and dropped, following changes are still applied.
+
+TEST_F(ModelMutationQueueTest, failingChange)
+{
+    SessionModel model;
+    auto vector = model.insertItem<VectorItem>();
+    auto x_identifier = vector->getItem(VectorItem::P_X)->identifier();
+
+    std::vector<std::string> errors;
+    ModelMutationQueue queue(&model);
+    queue.setOnError([&errors](const std::string& message) { errors.push_back(message); });
+
+    queue.postData(x_identifier, 1.0);
+    queue.postInsert(model.rootItem()->identifier(), "UnknownType", TagRow::append());
+    queue.postInsert(model.rootItem()->identifier(), Constants::VectorItemType, TagRow::append());
+    EXPECT_EQ(queue.process(), 2);
+
+    EXPECT_EQ(errors.size(), 1);
+    EXPECT_EQ(vector->property<double>(VectorItem::P_X), 1.0);
+    EXPECT_EQ(model.rootItem()->childrenCount(), 2);
+    EXPECT_EQ(queue.pendingCount(), 0);
+}
+
+//! Changes are posted from worker threads.
+
+TEST_F(ModelMutationQueueTest, postFromThreads)
+{
+    SessionModel model;
+    auto vector = model.insertItem<VectorItem>();
+    auto x_identifier = vector->getItem(VectorItem::P_X)->identifier();
+    auto y_path = Utils::PathFromItem(vector->getItem(VectorItem::P_Y));
+
+    ModelMutationQueue queue(&model);
+    int posted_count{0};
+    queue.setOnPosted([&posted_count]() { ++posted_count; });
+
+    const int n_values = 1000;
+    std::thread worker1([&]() {
+        for (int index = 1; index <= n_values; ++index)
+            queue.postData(x_identifier, static_cast<double>(index));
+    });
+    std::thread worker2([&]() {
+        for (int index = 1; index <= n_values; ++index)
+            queue.postData(y_path, static_cast<double>(-index));
+    });
+    worker1.join();
+    worker2.join();
+
+    EXPECT_EQ(posted_count, 1);
+    EXPECT_EQ(queue.pendingCount(), 2);
+    queue.process();
+    EXPECT_EQ(vector->property<double>(VectorItem::P_X), static_cast<double>(n_values));
+    EXPECT_EQ(vector->property<double>(VectorItem::P_Y), static_cast<double>(-n_values));
+}
@@ -10,6 +10,7 @@
 #include "mvvm/model/modelutils.h"
 
 #include "google_test.h"
+#include "mvvm/standarditems/vectoritem.h"
 #include "toyitems.h"
 #include "toymodel.h"
 
@@ -106,6 +107,50 @@ TEST_F(ModelUtilsTest, CreateClone)
     EXPECT_FALSE(model.rootItem()->identifier() == modelCopy->rootItem()->identifier());
 }
 
+//! Copying of the model with items supporting native copy.
+
+TEST_F(ModelUtilsTest, PopulateEmptyModelNative)
+{
+    SessionModel model;
+    auto vector = model.insertItem<VectorItem>();
+    vector->setX(42.0);
+
+    SessionModel target;
+    EXPECT_TRUE(Utils::PopulateEmptyModelNative(model, target, /*preserve_identifiers*/ true));
+    auto vector_copy = target.topItem<VectorItem>();
+    ASSERT_TRUE(vector_copy != nullptr);
+    EXPECT_EQ(vector_copy->x(), 42.0);
+    EXPECT_EQ(vector_copy->identifier(), vector->identifier());
+    EXPECT_EQ(target.findItem(vector->identifier()), vector_copy);
+    EXPECT_EQ(vector_copy->model(), &target);
+
+    auto model_copy = Utils::CreateCopy(model);
+    EXPECT_EQ(model_copy->topItem<VectorItem>()->x(), 42.0);
+    EXPECT_NE(model_copy->topItem<VectorItem>()->identifier(), vector->identifier());
+
+    // models of different types
+    SessionModel other("OtherModel");
+    EXPECT_THROW(Utils::PopulateEmptyModelNative(model, other, false), std::runtime_error);
+}
+
+//! Items of types which didn't opt in native copying are copied via json.
+
+TEST_F(ModelUtilsTest, PopulateEmptyModelNativeFallback)
+{
+    ToyItems::SampleModel model;
+    auto layer = model.insertItem<ToyItems::LayerItem>();
+    layer->setProperty(ToyItems::LayerItem::P_THICKNESS, 42.0);
+
+    ToyItems::SampleModel target;
+    EXPECT_FALSE(Utils::PopulateEmptyModelNative(model, target, /*preserve_identifiers*/ false));
+    EXPECT_EQ(target.rootItem()->childrenCount(), 0);
+
+    auto model_copy = Utils::CreateCopy<ToyItems::SampleModel>(model);
+    auto layer_copy = model_copy->topItem<ToyItems::LayerItem>();
+    ASSERT_TRUE(layer_copy != nullptr);
+    EXPECT_EQ(layer_copy->property<double>(ToyItems::LayerItem::P_THICKNESS), 42.0);
+}
+
 TEST_F(ModelUtilsTest, DeleteItemFromModel)
 {
     ToyItems::SampleModel model;
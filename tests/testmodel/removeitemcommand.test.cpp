@@ -10,11 +10,13 @@
 #include "mvvm/commands/removeitemcommand.h"
 
 #include "google_test.h"
+#include "mvvm/commands/removeitemscommand.h"
 #include "mvvm/model/compounditem.h"
 #include "mvvm/model/itemutils.h"
 #include "mvvm/model/sessionitem.h"
 #include "mvvm/model/sessionmodel.h"
 #include "mvvm/model/taginfo.h"
+#include <stdexcept>
 
 using namespace ModelView;
 
@@ -171,3 +173,29 @@ TEST_F(RemoveItemCommandTest, attemptToRemoveItem)
     EXPECT_TRUE(command->isObsolete());
     EXPECT_EQ(std::get<bool>(command->result()), false);
 }
+
+//! Undo of the range removal fails without side effects, if there is no place for the items.
+
+TEST_F(RemoveItemCommandTest, undoRangeWithoutPlace)
+{
+    SessionModel model;
+    auto parent = model.insertItem<SessionItem>(model.rootItem());
+    parent->registerTag(TagInfo("tag", 0, 3, {}), /*set_as_default*/ true);
+    auto items = model.insertItems<SessionItem>(parent, {"tag", 0}, 3);
+
+    RemoveItemsCommand command(parent, TagRow{"tag", 0}, 2);
+    command.execute();
+    EXPECT_EQ(parent->children(), std::vector<SessionItem*>({items[2]}));
+
+    // occupying the place of removed items behind the command's back
+    model.insertItems<SessionItem>(parent, {"tag", 0}, 2);
+
+    EXPECT_THROW(command.undo(), std::runtime_error);
+    EXPECT_EQ(parent->childrenCount(), 3);
+
+    // removed items are still kept, undo succeeds once the place is freed
+    delete parent->takeItem({"tag", 0});
+    delete parent->takeItem({"tag", 0});
+    command.undo();
+    EXPECT_EQ(parent->children(), std::vector<SessionItem*>({items[0], items[1], items[2]}));
+}
@@ -356,6 +356,31 @@ TEST_F(SessionItemTest, takeItem)
     delete taken;
 }
 
+//! Inserting range of items into parent.
+
+TEST_F(SessionItemTest, insertItems)
+{
+    auto parent = std::make_unique<SessionItem>();
+    parent->registerTag(TagInfo("tag", 0, 3, {}), /*set_as_default*/ true);
+    auto child0 = new SessionItem;
+    parent->insertItem(child0, TagRow::append());
+
+    auto child1 = std::make_unique<SessionItem>();
+    auto child2 = std::make_unique<SessionItem>();
+    auto child3 = std::make_unique<SessionItem>();
+
+    // nothing is inserted if the range doesn't fit
+    EXPECT_FALSE(parent->insertItems({child1.get(), child2.get(), child3.get()}, {"", 0}));
+    EXPECT_FALSE(parent->insertItems({child1.get()}, {"", 2}));
+    EXPECT_FALSE(parent->insertItems({}, {"", 0}));
+    EXPECT_EQ(parent->childrenCount(), 1);
+
+    EXPECT_TRUE(parent->insertItems({child1.get(), child2.get()}, {"", 0}));
+    std::vector<SessionItem*> expected = {child1.release(), child2.release(), child0};
+    EXPECT_EQ(parent->children(), expected);
+    EXPECT_EQ(expected[1]->parent(), parent.get());
+}
+
 //! Insert and take tagged items.
 
 TEST_F(SessionItemTest, singleTagAndItems)
@@ -720,3 +745,26 @@ TEST_F(SessionItemTest, itemsInTag)
     EXPECT_EQ(parent->itemCount(tag1), 1);
     EXPECT_EQ(parent->itemCount(tag2), 2);
 }
+
+//! Identifier generated on construction is formatted on first request.
+
+TEST_F(SessionItemTest, generatedIdentifier)
+{
+    SessionItem item;
+    auto id = item.generatedId();
+    EXPECT_FALSE(id.isNull());
+    EXPECT_EQ(item.identifier(), id.toString());
+    EXPECT_EQ(item.itemData()->data(ItemDataRole::IDENTIFIER).value<std::string>(), id.toString());
+
+    // identifier assigned from outside
+    item.setData(std::string("abc"), ItemDataRole::IDENTIFIER);
+    EXPECT_TRUE(item.generatedId().isNull());
+    EXPECT_EQ(item.identifier(), "abc");
+
+    // registration in the pool without string formatting
+    SessionItem item2;
+    ItemPool pool;
+    pool.register_item(&item2, item2.generatedId());
+    EXPECT_EQ(pool.item_for_key(item2.identifier()), &item2);
+    EXPECT_EQ(pool.key_for_item(&item2), item2.identifier());
+}
@@ -11,6 +11,8 @@
 
 #include "google_test.h"
 #include "mvvm/model/sessionitem.h"
+#include <memory>
+#include <vector>
 
 using namespace ModelView;
 
@@ -146,6 +148,41 @@ TEST_F(SessionItemContainerTest, indexOfItem)
     EXPECT_EQ(tag.indexOfItem(child3.get()), -1);
 }
 
+//! Checking ::indexOfItem after insertion and removal of items in the middle of the container.
+
+TEST_F(SessionItemContainerTest, indexOfItemAfterModifications)
+{
+    SessionItemContainer tag(TagInfo::universalTag("tag"));
+    SessionItemContainer other_tag(TagInfo::universalTag("other_tag"));
+
+    std::vector<SessionItem*> expected;
+    for (int i = 0; i < 10; ++i) {
+        expected.push_back(new SessionItem);
+        EXPECT_TRUE(tag.insertItem(expected.back(), tag.itemCount()));
+    }
+
+    // insertion into the middle and in front
+    auto child = new SessionItem;
+    EXPECT_TRUE(tag.insertItem(child, 5));
+    expected.insert(expected.begin() + 5, child);
+    child = new SessionItem;
+    EXPECT_TRUE(tag.insertItem(child, 0));
+    expected.insert(expected.begin(), child);
+
+    // removal
+    std::unique_ptr<SessionItem> taken(tag.takeItem(3));
+    expected.erase(expected.begin() + 3);
+    EXPECT_EQ(tag.indexOfItem(taken.get()), -1);
+
+    for (size_t row = 0; row < expected.size(); ++row)
+        EXPECT_EQ(tag.indexOfItem(expected[row]), static_cast<int>(row));
+
+    // item belongs to another container
+    EXPECT_TRUE(other_tag.insertItem(taken.release(), 0));
+    EXPECT_EQ(tag.indexOfItem(other_tag.itemAt(0)), -1);
+    EXPECT_EQ(other_tag.indexOfItem(other_tag.itemAt(0)), 0);
+}
+
 //! Checking ::itemAt.
 
 TEST_F(SessionItemContainerTest, itemAt)
@@ -161,3 +161,56 @@ TEST_F(SessionItemDataTest, hasRole)
     data.setData(QVariant(), role);
     EXPECT_FALSE(data.hasData(role));
 }
+
+//! Access to the data without copying.
+
+TEST_F(SessionItemDataTest, dataRef)
+{
+    SessionItemData data;
+    EXPECT_FALSE(data.dataRef(ItemDataRole::DATA).isValid());
+
+    const std::vector<double> expected = {1.0, 2.0, 3.0};
+    data.setData(QVariant::fromValue(expected), ItemDataRole::DATA);
+
+    const auto& ref = data.dataRef(ItemDataRole::DATA);
+    EXPECT_EQ(ref.value<std::vector<double>>(), expected);
+    EXPECT_EQ(&ref, &data.dataRef(ItemDataRole::DATA));
+}
+
+//! Predefined and user roles are mixed, order of appearance is preserved on removal.
+
+TEST_F(SessionItemDataTest, mixedRoles)
+{
+    SessionItemData data;
+    const int user_role = 99;
+
+    data.setData(QVariant::fromValue(std::string("id")), ItemDataRole::IDENTIFIER);
+    data.setData(QVariant::fromValue(42), user_role);
+    data.setData(QVariant::fromValue(std::string("name")), ItemDataRole::DISPLAY);
+    data.setData(QVariant::fromValue(1.0), ItemDataRole::DATA);
+
+    std::vector<int> expected{ItemDataRole::IDENTIFIER, user_role, ItemDataRole::DISPLAY,
+                              ItemDataRole::DATA};
+    EXPECT_EQ(data.roles(), expected);
+
+    // removing user role in the middle
+    data.setData(QVariant(), user_role);
+    expected = {ItemDataRole::IDENTIFIER, ItemDataRole::DISPLAY, ItemDataRole::DATA};
+    EXPECT_EQ(data.roles(), expected);
+    EXPECT_FALSE(data.hasData(user_role));
+    EXPECT_EQ(data.data(ItemDataRole::DISPLAY).value<std::string>(), "name");
+    EXPECT_EQ(data.data(ItemDataRole::DATA).value<double>(), 1.0);
+
+    // removing predefined role
+    data.setData(QVariant(), ItemDataRole::IDENTIFIER);
+    expected = {ItemDataRole::DISPLAY, ItemDataRole::DATA};
+    EXPECT_EQ(data.roles(), expected);
+    EXPECT_FALSE(data.hasData(ItemDataRole::IDENTIFIER));
+    EXPECT_EQ(data.data(ItemDataRole::DATA).value<double>(), 1.0);
+
+    // adding role back
+    data.setData(QVariant::fromValue(43), user_role);
+    expected = {ItemDataRole::DISPLAY, ItemDataRole::DATA, user_role};
+    EXPECT_EQ(data.roles(), expected);
+    EXPECT_EQ(data.data(user_role).value<int>(), 43);
+}
@@ -216,3 +216,35 @@ TEST_F(SessionItemTagsTest, isSinglePropertyTag)
 
     EXPECT_FALSE(tag.isSinglePropertyTag("unexisting tag"));
 }
+
+//! Access to containers when many tags are registered.
+
+TEST_F(SessionItemTagsTest, manyTags)
+{
+    SessionItemTags tag;
+    const int tag_count = 50;
+    std::vector<SessionItem*> children;
+    for (int i = 0; i < tag_count; ++i) {
+        auto name = "tag" + std::to_string(i);
+        tag.registerTag(TagInfo::universalTag(name));
+        children.push_back(new SessionItem);
+        EXPECT_TRUE(tag.insertItem(children.back(), {name, 0}));
+        // few tags are searched linearly, the index is built when their number grows
+        EXPECT_EQ(tag.itemAt("tag0", 0), children.front());
+    }
+    EXPECT_EQ(tag.tagsCount(), tag_count);
+
+    for (int i = 0; i < tag_count; ++i) {
+        auto name = "tag" + std::to_string(i);
+        EXPECT_TRUE(tag.isTag(name));
+        EXPECT_EQ(tag.itemCount(name), 1);
+        EXPECT_EQ(tag.itemAt(name, 0), children[static_cast<size_t>(i)]);
+        EXPECT_EQ(tag.getItem({name, 0}), children[static_cast<size_t>(i)]);
+        EXPECT_EQ(tag.itemAt(name, 1), nullptr);
+    }
+
+    EXPECT_FALSE(tag.isTag("tag50"));
+    EXPECT_FALSE(tag.isTag(""));
+    EXPECT_THROW(tag.itemAt("tag50", 0), std::runtime_error);
+    EXPECT_THROW(tag.registerTag(TagInfo::universalTag("tag0")), std::runtime_error);
+}
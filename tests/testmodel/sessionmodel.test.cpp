@@ -10,12 +10,15 @@
 #include "mvvm/model/sessionmodel.h"
 
 #include "google_test.h"
+#include "mvvm/interfaces/undostackinterface.h"
 #include "mvvm/model/compounditem.h"
 #include "mvvm/model/itempool.h"
 #include "mvvm/model/itemutils.h"
 #include "mvvm/model/propertyitem.h"
 #include "mvvm/model/sessionitem.h"
 #include "mvvm/model/taginfo.h"
+#include "mvvm/signals/itemmapper.h"
+#include "mvvm/signals/modelmapper.h"
 #include <memory>
 #include <stdexcept>
 
@@ -139,6 +142,162 @@ TEST_F(SessionModelTest, insertNewItemWithTag)
     EXPECT_EQ(Utils::IndexOfChild(parent, child2), 0);
 }
 
+//! Insertion of the range of items.
+
+TEST_F(SessionModelTest, insertItems)
+{
+    SessionModel model;
+    model.setUndoRedoEnabled(true);
+    auto parent = model.insertItem<SessionItem>();
+    parent->registerTag(TagInfo::universalTag("tag"), /*set_as_default*/ true);
+    auto first = model.insertItem<PropertyItem>(parent);
+
+    int inserted_count{0};
+    std::vector<int> ranges;
+    model.mapper()->setOnItemInserted([&](SessionItem*, const TagRow&) { ++inserted_count; },
+                                      nullptr);
+    model.mapper()->setOnItemsInserted(
+        [&](SessionItem*, const TagRow& tagrow, int count) {
+            ranges.push_back(tagrow.row);
+            ranges.push_back(count);
+        },
+        nullptr);
+
+    // inserting three items in front of existing one
+    auto items = model.insertItems<PropertyItem>(parent, {"tag", 0}, 3);
+    ASSERT_EQ(items.size(), 3);
+    EXPECT_EQ(parent->children(), std::vector<SessionItem*>({items[0], items[1], items[2], first}));
+    EXPECT_EQ(inserted_count, 3);
+    EXPECT_EQ(ranges, std::vector<int>({0, 3}));
+
+    // single command in undo stack
+    EXPECT_EQ(model.undoStack()->count(), 3);
+    auto identifiers = std::vector<std::string>({items[0]->identifier(), items[2]->identifier()});
+    model.undoStack()->undo();
+    EXPECT_EQ(parent->children(), std::vector<SessionItem*>({first}));
+
+    model.undoStack()->redo();
+    ASSERT_EQ(parent->childrenCount(), 4);
+    EXPECT_EQ(parent->getItem("tag", 0)->identifier(), identifiers[0]);
+    EXPECT_EQ(parent->getItem("tag", 2)->identifier(), identifiers[1]);
+
+    // appending by model type
+    auto appended = model.insertNewItems(Constants::PropertyType, parent, {"tag", -1}, 2);
+    ASSERT_EQ(appended.size(), 2);
+    EXPECT_EQ(parent->getItem("tag", 4), appended[0]);
+    EXPECT_EQ(parent->getItem("tag", 5), appended[1]);
+}
+
+//! Insertion of the range of items which doesn't fit into the tag.
+
+TEST_F(SessionModelTest, insertItemsBeyondLimit)
+{
+    SessionModel model;
+    auto parent = model.insertItem<SessionItem>();
+    parent->registerTag(TagInfo("tag", 0, 2, {Constants::PropertyType}), /*set_as_default*/ true);
+
+    EXPECT_TRUE(model.insertItems<PropertyItem>(parent, {"tag", 0}, 3).empty());
+    EXPECT_TRUE(model.insertItems<SessionItem>(parent, {"tag", 0}, 1).empty());
+    EXPECT_TRUE(model.insertItems<PropertyItem>(parent, {"tag", 0}, 0).empty());
+    EXPECT_EQ(parent->childrenCount(), 0);
+
+    EXPECT_EQ(model.insertItems<PropertyItem>(parent, {"tag", 0}, 2).size(), 2);
+}
+
+//! Removal of the range of items.
+
+TEST_F(SessionModelTest, removeItems)
+{
+    SessionModel model;
+    model.setUndoRedoEnabled(true);
+    auto parent = model.insertItem<SessionItem>();
+    parent->registerTag(TagInfo::universalTag("tag"), /*set_as_default*/ true);
+    auto items = model.insertItems<PropertyItem>(parent, {"tag", 0}, 5);
+    auto identifier = items[2]->identifier();
+
+    int about_to_remove_count{0};
+    std::vector<int> about_to_remove_ranges;
+    std::vector<int> removed_ranges;
+    model.mapper()->setOnAboutToRemoveItem(
+        [&](SessionItem*, const TagRow&) { ++about_to_remove_count; }, nullptr);
+    model.mapper()->setOnAboutToRemoveItems(
+        [&](SessionItem*, const TagRow& tagrow, int count) {
+            about_to_remove_ranges.push_back(tagrow.row);
+            about_to_remove_ranges.push_back(count);
+        },
+        nullptr);
+    model.mapper()->setOnItemsRemoved(
+        [&](SessionItem*, const TagRow& tagrow, int count) {
+            removed_ranges.push_back(tagrow.row);
+            removed_ranges.push_back(count);
+        },
+        nullptr);
+
+    // removing three items in the middle
+    EXPECT_TRUE(model.removeItems(parent, "tag", 1, 3));
+    EXPECT_EQ(parent->children(), std::vector<SessionItem*>({items[0], items[4]}));
+    EXPECT_EQ(about_to_remove_count, 3);
+    EXPECT_EQ(about_to_remove_ranges, std::vector<int>({1, 3}));
+    EXPECT_EQ(removed_ranges, std::vector<int>({1, 3}));
+
+    // single command in undo stack, removed items are restored in their rows
+    EXPECT_EQ(model.undoStack()->count(), 3);
+    model.undoStack()->undo();
+    ASSERT_EQ(parent->childrenCount(), 5);
+    EXPECT_EQ(parent->getItem("tag", 0), items[0]);
+    EXPECT_EQ(parent->getItem("tag", 2)->identifier(), identifier);
+    EXPECT_EQ(parent->getItem("tag", 4), items[4]);
+
+    model.undoStack()->redo();
+    EXPECT_EQ(parent->children(), std::vector<SessionItem*>({items[0], items[4]}));
+
+    // range outside of the tag
+    EXPECT_FALSE(model.removeItems(parent, "tag", 1, 2));
+    EXPECT_EQ(parent->childrenCount(), 2);
+}
+
+//! Batch of range removal is closed even if the listener throws.
+
+TEST_F(SessionModelTest, takeItemsWithThrowingListener)
+{
+    SessionModel model;
+    auto parent = model.insertItem<SessionItem>();
+    parent->registerTag(TagInfo::universalTag("tag"), /*set_as_default*/ true);
+    model.insertItems<PropertyItem>(parent, {"tag", 0}, 3);
+
+    model.mapper()->setOnAboutToRemoveItems(
+        [](SessionItem*, const TagRow&, int) { throw std::runtime_error("error in callback"); },
+        nullptr);
+
+    EXPECT_THROW(parent->takeItems({"tag", 0}, 2), std::runtime_error);
+    EXPECT_FALSE(model.mapper()->isBatching());
+    EXPECT_EQ(parent->childrenCount(), 3);
+}
+
+//! Removal of all items of the tag.
+
+TEST_F(SessionModelTest, clearTag)
+{
+    SessionModel model;
+    model.setUndoRedoEnabled(true);
+    auto parent = model.insertItem<SessionItem>();
+    parent->registerTag(TagInfo::universalTag("tag"), /*set_as_default*/ true);
+    parent->registerTag(TagInfo("limited", 1, -1, {}));
+    model.insertItems<PropertyItem>(parent, {"tag", 0}, 3);
+    model.insertItems<PropertyItem>(parent, {"limited", 0}, 2);
+
+    EXPECT_TRUE(model.clearTag(parent, "tag"));
+    EXPECT_EQ(parent->itemCount("tag"), 0);
+    EXPECT_FALSE(model.clearTag(parent, "tag"));
+
+    // tag with minimum number of items can't be cleared
+    EXPECT_FALSE(model.clearTag(parent, "limited"));
+    EXPECT_EQ(parent->itemCount("limited"), 2);
+
+    model.undoStack()->undo();
+    EXPECT_EQ(parent->itemCount("tag"), 3);
+}
+
 TEST_F(SessionModelTest, setData)
 {
     SessionModel model;
@@ -282,6 +441,59 @@ TEST_F(SessionModelTest, clearRebuildModel)
     EXPECT_EQ(pool->key_for_item(new_item), new_item->identifier());
 }
 
+//! Clearing the model which owns its pool exclusively. Registrations are dropped at once.
+
+TEST_F(SessionModelTest, clearModelWithOwnPool)
+{
+    SessionModel model;
+    model.setUndoRedoEnabled(true);
+
+    auto items = model.insertItems<PropertyItem>(model.rootItem(), {"", 0}, 3);
+    auto identifier = items[1]->identifier();
+    EXPECT_EQ(model.findItem(identifier), items[1]);
+
+    int about_to_reset_count{0};
+    model.mapper()->setOnModelAboutToBeReset([&](SessionModel*) { ++about_to_reset_count; },
+                                             nullptr);
+
+    model.clear();
+    EXPECT_EQ(about_to_reset_count, 1);
+    EXPECT_EQ(model.rootItem()->childrenCount(), 0);
+    EXPECT_EQ(model.findItem(identifier), nullptr);
+    EXPECT_EQ(model.findItem(model.rootItem()->identifier()), model.rootItem());
+    EXPECT_TRUE(model.findItems(Constants::PropertyType).empty());
+
+    // model remains fully functional
+    auto item = model.insertItem<PropertyItem>();
+    EXPECT_EQ(model.findItem(item->identifier()), item);
+    EXPECT_EQ(model.findItems(Constants::PropertyType), std::vector<SessionItem*>({item}));
+    model.removeItem(model.rootItem(), {"", 0});
+    EXPECT_EQ(model.findItem(item->identifier()), nullptr);
+}
+
+//! Items of the current tree, removed by callbacks running while the old tree is destroyed, leave
+//! the index and the pool.
+
+TEST_F(SessionModelTest, clearWithCallbackRemovingItems)
+{
+    SessionModel model;
+    auto old_item = model.insertItem<PropertyItem>();
+
+    std::string new_identifier;
+    auto on_destroy = [&model, &new_identifier](SessionItem*) {
+        new_identifier = model.insertItem<PropertyItem>()->identifier();
+        model.removeItem(model.rootItem(), {"", 0});
+    };
+    old_item->mapper()->setOnItemDestroy(on_destroy, nullptr);
+
+    model.clear();
+    ASSERT_FALSE(new_identifier.empty());
+    EXPECT_EQ(model.rootItem()->childrenCount(), 0);
+    EXPECT_EQ(model.findItem(new_identifier), nullptr);
+    EXPECT_TRUE(model.findItems<PropertyItem>().empty());
+    EXPECT_EQ(model.findItems<>().size(), 1);
+}
+
 //! Tests item copy when from root item to root item.
 
 TEST_F(SessionModelTest, copyModelItemRootContext)
@@ -457,3 +669,34 @@ TEST_F(SessionModelTest, registerItem)
     ASSERT_TRUE(dynamic_cast<TestItem*>(item) != nullptr);
     EXPECT_EQ(item->modelType(), expectedModelType);
 }
+
+//! Model with items allocated in the arena.
+
+TEST_F(SessionModelTest, arenaAllocation)
+{
+    SessionModel model;
+    model.setArenaAllocationEnabled(true);
+    model.setUndoRedoEnabled(true);
+
+    auto parent = model.insertItem<CompoundItem>();
+    parent->addProperty("height", 42.0);
+    model.insertNewItem(Constants::PropertyType);
+    auto copy = model.copyItem(parent, model.rootItem());
+    ASSERT_TRUE(copy != nullptr);
+    EXPECT_EQ(copy->property<double>("height"), 42.0);
+    EXPECT_EQ(model.rootItem()->childrenCount(), 3);
+
+    model.removeItem(model.rootItem(), {"", 0});
+    EXPECT_EQ(model.rootItem()->childrenCount(), 2);
+    model.undoStack()->undo();
+    EXPECT_EQ(model.rootItem()->childrenCount(), 3);
+    EXPECT_EQ(model.topItem<CompoundItem>()->property<double>("height"), 42.0);
+
+    // switching back to the heap doesn't affect existing items
+    model.setArenaAllocationEnabled(false);
+    model.insertItem<PropertyItem>();
+    EXPECT_EQ(model.rootItem()->childrenCount(), 4);
+
+    model.clear();
+    EXPECT_EQ(model.rootItem()->childrenCount(), 0);
+}
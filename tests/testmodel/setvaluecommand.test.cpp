@@ -70,3 +70,26 @@ TEST_F(SetValueCommandTest, setSameValueCommand)
     // undoing command which is in isObsolete state is not possible
     EXPECT_THROW(command->undo(), std::runtime_error);
 }
+
+//! Command addresses its item by identifier, so items inserted in front of it don't matter.
+
+TEST_F(SetValueCommandTest, setValueAfterItemShift)
+{
+    SessionModel model;
+    const int role = ItemDataRole::DATA;
+
+    auto item = model.insertItem<SessionItem>();
+    auto command = std::make_unique<SetValueCommand>(item, QVariant(42.0), role);
+    command->execute();
+
+    // inserting sibling in front of the item, its position in the tree changes
+    auto sibling = model.insertItem<SessionItem>(model.rootItem(), {"", 0});
+
+    command->undo();
+    EXPECT_FALSE(model.data(item, role).isValid());
+    EXPECT_FALSE(model.data(sibling, role).isValid());
+
+    command->execute();
+    EXPECT_EQ(model.data(item, role), QVariant(42.0));
+    EXPECT_FALSE(model.data(sibling, role).isValid());
+}
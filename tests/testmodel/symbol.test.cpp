@@ -0,0 +1,60 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/core/symbol.h"
+
+#include "google_test.h"
+#include "mvvm/model/sessionitem.h"
+#include <unordered_map>
+
+using namespace ModelView;
+
+//! Testing Symbol.
+
+class SymbolTest : public ::testing::Test {
+};
+
+TEST_F(SymbolTest, initialState)
+{
+    Symbol symbol;
+    EXPECT_TRUE(symbol.empty());
+    EXPECT_EQ(symbol.str(), std::string());
+    EXPECT_EQ(symbol, Symbol(""));
+}
+
+TEST_F(SymbolTest, interning)
+{
+    Symbol symbol1("SymbolTest");
+    Symbol symbol2(std::string("Symbol") + "Test");
+    EXPECT_FALSE(symbol1.empty());
+    EXPECT_EQ(symbol1, symbol2);
+    EXPECT_EQ(&symbol1.str(), &symbol2.str());
+    EXPECT_NE(symbol1, Symbol("SymbolTest2"));
+
+    std::unordered_map<Symbol, int> map = {{symbol1, 42}};
+    EXPECT_EQ(map[symbol2], 42);
+}
+
+TEST_F(SymbolTest, find)
+{
+    EXPECT_TRUE(Symbol::find("SymbolTest.find").empty());
+    Symbol symbol("SymbolTest.find");
+    EXPECT_EQ(Symbol::find("SymbolTest.find"), symbol);
+}
+
+//! Items of the same type share the model type string.
+
+TEST_F(SymbolTest, itemModelType)
+{
+    SessionItem item1("SymbolTest.item");
+    SessionItem item2("SymbolTest.item");
+    EXPECT_EQ(item1.modelType(), "SymbolTest.item");
+    EXPECT_EQ(&item1.modelType(), &item2.modelType());
+    EXPECT_EQ(item1.modelTypeSymbol(), Symbol("SymbolTest.item"));
+}
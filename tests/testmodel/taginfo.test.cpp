@@ -85,3 +85,35 @@ TEST_F(TagInfoTest, equalityOperator)
     EXPECT_FALSE(tag7 == tag8);
     EXPECT_TRUE(tag7 != tag8);
 }
+
+//! Tags with the same content share the same schema.
+
+TEST_F(TagInfoTest, sharedSchema)
+{
+    TagInfo tag1 = TagInfo::propertyTag("name", "model_type");
+    TagInfo tag2 = TagInfo::propertyTag("name", "model_type");
+    EXPECT_EQ(&tag1.name(), &tag2.name());
+
+    TagInfo tag3("ab", 0, 1, {"c"});
+    TagInfo tag4("a", 0, 1, {"bc"});
+    EXPECT_NE(&tag3.name(), &tag4.name());
+    EXPECT_FALSE(tag3 == tag4);
+}
+
+//! Validity check for the tag with long list of allowed model types.
+
+TEST_F(TagInfoTest, isValidChild)
+{
+    std::vector<std::string> model_types;
+    for (int i = 0; i < 10; ++i)
+        model_types.push_back("type" + std::to_string(i));
+
+    TagInfo tag = TagInfo::universalTag("name", model_types);
+    EXPECT_TRUE(tag.isValidChild("type0"));
+    EXPECT_TRUE(tag.isValidChild("type9"));
+    EXPECT_FALSE(tag.isValidChild("type10"));
+    EXPECT_EQ(tag.modelTypes(), model_types);
+
+    EXPECT_TRUE(TagInfo::universalTag("name").isValidChild("type10"));
+    EXPECT_FALSE(TagInfo::propertyTag("name", "type0").isValidChild("type1"));
+}
@@ -908,3 +908,148 @@ TEST_F(UndoStackTest, insertDataItemViaMacro)
     EXPECT_EQ(restoredDataItem->binCenters(), expected_centers);
     EXPECT_EQ(restoredDataItem->binValues(), expected_values);
 }
+
+//! Successive changes of the same value within merge scope result in a single command.
+
+TEST_F(UndoStackTest, mergeScope)
+{
+    SessionModel model;
+    model.setUndoRedoEnabled(true);
+    auto item = model.insertItem<PropertyItem>();
+    auto other = model.insertItem<PropertyItem>();
+    item->setData(0.0);
+    auto stack = model.undoStack();
+    EXPECT_EQ(stack->count(), 3);
+
+    // imitating slider dragging
+    stack->beginMergeScope();
+    for (int index = 1; index <= 10; ++index)
+        item->setData(static_cast<double>(index));
+    stack->endMergeScope();
+    EXPECT_EQ(stack->count(), 4);
+    EXPECT_EQ(item->data<double>(), 10.0);
+
+    // changes of other item or other role are not merged
+    stack->beginMergeScope();
+    item->setData(11.0);
+    other->setData(42.0);
+    item->setData(12.0);
+    item->setToolTip("abc");
+    stack->endMergeScope();
+    EXPECT_EQ(stack->count(), 8);
+
+    // changes outside of the scope are not merged
+    item->setData(13.0);
+    item->setData(14.0);
+    EXPECT_EQ(stack->count(), 10);
+
+    for (int index = 0; index < 6; ++index)
+        stack->undo();
+    EXPECT_EQ(item->data<double>(), 10.0);
+
+    // undo of the merged command restores the value before the scope
+    stack->undo();
+    EXPECT_EQ(item->data<double>(), 0.0);
+
+    stack->redo();
+    EXPECT_EQ(item->data<double>(), 10.0);
+}
+
+//! Successive changes of the same value within time interval result in a single command.
+
+TEST_F(UndoStackTest, mergeInterval)
+{
+    SessionModel model;
+    model.setUndoRedoEnabled(true);
+    auto item = model.insertItem<PropertyItem>();
+    item->setData(0.0);
+    auto stack = model.undoStack();
+    EXPECT_EQ(stack->count(), 2);
+
+    stack->setMergeInterval(60000);
+    for (int index = 1; index <= 10; ++index)
+        item->setData(static_cast<double>(index));
+    EXPECT_EQ(stack->count(), 3);
+
+    stack->undo();
+    EXPECT_EQ(item->data<double>(), 0.0);
+    stack->redo();
+    EXPECT_EQ(item->data<double>(), 10.0);
+
+    // disabling merging
+    stack->setMergeInterval(0);
+    item->setData(11.0);
+    item->setData(12.0);
+    EXPECT_EQ(stack->count(), 5);
+}
+
+//! Oldest commands are released, when commands in the stack hold more memory than allowed.
+
+TEST_F(UndoStackTest, memoryLimit)
+{
+    SessionModel model;
+    model.setUndoRedoEnabled(true);
+    auto item = model.insertItem<PropertyItem>();
+    auto stack = model.undoStack();
+    const size_t array_size = 1000 * sizeof(double);
+
+    // each command keeps previous array for undo
+    for (int index = 1; index <= 4; ++index)
+        item->setData(std::vector<double>(1000, index));
+    EXPECT_EQ(stack->count(), 5);
+    EXPECT_GT(stack->memoryUsage(), 3 * array_size);
+
+    stack->setMemoryLimit(2 * array_size);
+    EXPECT_LE(stack->memoryUsage(), 2 * array_size);
+    EXPECT_GT(stack->memoryUsage(), array_size);
+    EXPECT_EQ(stack->count(), 5);
+
+    // last command can be undone, older commands were released
+    EXPECT_TRUE(stack->canUndo());
+    stack->undo();
+    EXPECT_EQ(item->data<std::vector<double>>(), std::vector<double>(1000, 3));
+    EXPECT_FALSE(stack->canUndo());
+    stack->undo();
+    EXPECT_EQ(item->data<std::vector<double>>(), std::vector<double>(1000, 3));
+
+    stack->redo();
+    EXPECT_EQ(item->data<std::vector<double>>(), std::vector<double>(1000, 4));
+
+    // backup of removed item is accounted too
+    auto usage = stack->memoryUsage();
+    stack->setMemoryLimit(0);
+    model.removeItem(model.rootItem(), {"", 0});
+    EXPECT_GT(stack->memoryUsage(), usage + array_size);
+}
+
+//! Memory usage follows commands dropped by the stack itself, and released commands are not
+//! visited again.
+
+TEST_F(UndoStackTest, memoryUsageAfterDrop)
+{
+    SessionModel model;
+    model.setUndoRedoEnabled(true);
+    auto item = model.insertItem<PropertyItem>();
+    auto stack = model.undoStack();
+    const size_t array_size = 1000 * sizeof(double);
+
+    for (int index = 1; index <= 3; ++index)
+        item->setData(std::vector<double>(1000, index));
+    EXPECT_GT(stack->memoryUsage(), 2 * array_size);
+
+    // undone command is dropped by the next push
+    stack->undo();
+    item->setData(42.0);
+    EXPECT_GT(stack->memoryUsage(), array_size);
+    EXPECT_LT(stack->memoryUsage(), 3 * array_size);
+
+    // budget is kept while new commands arrive
+    stack->setMemoryLimit(2 * array_size);
+    for (int index = 1; index <= 3; ++index) {
+        item->setData(std::vector<double>(1000, index));
+        EXPECT_LE(stack->memoryUsage(), 2 * array_size);
+    }
+
+    stack->clear();
+    EXPECT_EQ(stack->memoryUsage(), 0);
+}
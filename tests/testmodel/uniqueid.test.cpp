@@ -0,0 +1,74 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/core/uniqueid.h"
+
+#include "google_test.h"
+#include "mvvm/core/uniqueidgenerator.h"
+
+using namespace ModelView;
+
+//! Testing UniqueId.
+
+class UniqueIdTest : public ::testing::Test {
+};
+
+TEST_F(UniqueIdTest, initialState)
+{
+    UniqueId id;
+    EXPECT_TRUE(id.isNull());
+    EXPECT_EQ(id.toString(), "{00000000-0000-0000-0000-000000000000}");
+}
+
+TEST_F(UniqueIdTest, isCanonical)
+{
+    EXPECT_TRUE(UniqueId::isCanonical("{67c8770b-44f1-410a-ab9a-f9b5446f13ee}"));
+    EXPECT_FALSE(UniqueId::isCanonical("{67C8770B-44F1-410A-AB9A-F9B5446F13EE}"));
+    EXPECT_FALSE(UniqueId::isCanonical("67c8770b-44f1-410a-ab9a-f9b5446f13ee"));
+    EXPECT_FALSE(UniqueId::isCanonical("{67c8770b-44f1-410a-ab9a+f9b5446f13ee}"));
+    EXPECT_FALSE(UniqueId::isCanonical("abc-cde-fgh"));
+    EXPECT_FALSE(UniqueId::isCanonical(""));
+}
+
+//! Conversion of canonical identifiers goes without loss.
+
+TEST_F(UniqueIdTest, fromCanonicalString)
+{
+    const std::string str("{67c8770b-44f1-410a-ab9a-f9b5446f13ee}");
+    auto id = UniqueId::fromString(str);
+    EXPECT_EQ(id.high(), 0x67c8770b44f1410aULL);
+    EXPECT_EQ(id.low(), 0xab9af9b5446f13eeULL);
+    EXPECT_EQ(id.toString(), str);
+    EXPECT_EQ(UniqueId(0x67c8770b44f1410aULL, 0xab9af9b5446f13eeULL), id);
+
+    auto generated = UniqueIdGenerator::generate();
+    EXPECT_EQ(UniqueId::fromString(generated).toString(), generated);
+}
+
+//! Non-canonical strings are hashed.
+
+TEST_F(UniqueIdTest, fromCustomString)
+{
+    auto id1 = UniqueId::fromString("abc-cde-fgh");
+    auto id2 = UniqueId::fromString("abc-cde-fgi");
+    EXPECT_FALSE(id1.isNull());
+    EXPECT_EQ(id1, UniqueId::fromString("abc-cde-fgh"));
+    EXPECT_NE(id1, id2);
+    EXPECT_NE(UniqueId::fromString("{67C8770B-44F1-410A-AB9A-F9B5446F13EE}"),
+              UniqueId::fromString("{67c8770b-44f1-410a-ab9a-f9b5446f13ee}"));
+}
+
+TEST_F(UniqueIdTest, comparison)
+{
+    EXPECT_TRUE(UniqueId(1, 2) == UniqueId(1, 2));
+    EXPECT_TRUE(UniqueId(1, 2) != UniqueId(2, 1));
+    EXPECT_TRUE(UniqueId(1, 2) < UniqueId(1, 3));
+    EXPECT_TRUE(UniqueId(1, 3) < UniqueId(2, 0));
+    EXPECT_NE(UniqueId(0, 1).hash(), UniqueId(0, 2).hash());
+}
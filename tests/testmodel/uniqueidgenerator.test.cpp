@@ -0,0 +1,67 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/core/uniqueidgenerator.h"
+
+#include "google_test.h"
+#include <set>
+
+using namespace ModelView;
+
+//! Testing UniqueIdGenerator and its strategies.
+
+class UniqueIdGeneratorTest : public ::testing::Test {
+public:
+    ~UniqueIdGeneratorTest() override { UniqueIdGenerator::setGenerator({}); }
+};
+
+//! Default generator produces distinct identifiers in canonical UUID form.
+
+TEST_F(UniqueIdGeneratorTest, defaultGenerator)
+{
+    std::set<identifier_type> identifiers;
+    for (int i = 0; i < 1000; ++i) {
+        auto id = UniqueIdGenerator::generate();
+        EXPECT_TRUE(UniqueId::isCanonical(id));
+        identifiers.insert(id);
+    }
+    EXPECT_EQ(identifiers.size(), 1000u);
+}
+
+//! Sequential generator looks like version 4 UUID.
+
+TEST_F(UniqueIdGeneratorTest, sequentialGenerator)
+{
+    SequentialIdGenerator generator(0x123456789abcdef0ULL);
+    auto id0 = generator();
+    auto id1 = generator();
+    EXPECT_EQ(id0.toString(), "{12345678-9abc-4ef0-8000-000000000000}");
+    EXPECT_EQ(id1.toString(), "{12345678-9abc-4ef0-8000-000000000001}");
+
+    // copies share the counter
+    auto copy = generator;
+    EXPECT_EQ(copy().toString(), "{12345678-9abc-4ef0-8000-000000000002}");
+    EXPECT_EQ(generator().toString(), "{12345678-9abc-4ef0-8000-000000000003}");
+
+    // generators with different seeds don't clash
+    EXPECT_NE(SequentialIdGenerator()(), SequentialIdGenerator()());
+}
+
+//! Replacing generation strategy.
+
+TEST_F(UniqueIdGeneratorTest, setGenerator)
+{
+    UniqueIdGenerator::setGenerator(SequentialIdGenerator(0));
+    EXPECT_EQ(UniqueIdGenerator::generate(), "{00000000-0000-4000-8000-000000000000}");
+    EXPECT_EQ(UniqueIdGenerator::generateId().toString(), "{00000000-0000-4000-8000-000000000001}");
+
+    UniqueIdGenerator::setGenerator(UniqueIdGenerator::createUuid);
+    EXPECT_NE(UniqueIdGenerator::generateId(), UniqueIdGenerator::generateId());
+    EXPECT_TRUE(UniqueId::isCanonical(UniqueIdGenerator::generate()));
+}
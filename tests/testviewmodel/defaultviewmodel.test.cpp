@@ -235,6 +235,39 @@ TEST_F(DefaultViewModelTest, insertSingleTopItem)
     EXPECT_EQ(arguments.at(2).value<int>(), 0);
 }
 
+//! Inserting range of top level items.
+
+TEST_F(DefaultViewModelTest, insertTopItemsRange)
+{
+    SessionModel model;
+    model.insertItem<SessionItem>();
+    DefaultViewModel viewModel(&model);
+
+    QSignalSpy spyInsert(&viewModel, &DefaultViewModel::rowsInserted);
+
+    // inserting three vectors in front of existing item
+    auto vectors = model.insertItems<VectorItem>(model.rootItem(), {"", 0}, 3);
+
+    // single notification about the whole range
+    EXPECT_EQ(spyInsert.count(), 1);
+    QList<QVariant> arguments = spyInsert.takeFirst();
+    EXPECT_EQ(arguments.at(0).value<QModelIndex>(), QModelIndex());
+    EXPECT_EQ(arguments.at(1).value<int>(), 0);
+    EXPECT_EQ(arguments.at(2).value<int>(), 2);
+
+    // views are in place together with views of vector's properties
+    EXPECT_EQ(viewModel.rowCount(), 4);
+    for (int row = 0; row < 3; ++row) {
+        auto vector = vectors[static_cast<size_t>(row)];
+        auto index = viewModel.index(row, 0);
+        EXPECT_EQ(viewModel.sessionItemFromIndex(index), vector);
+        EXPECT_EQ(viewModel.rowCount(index), 3);
+        auto x_index = viewModel.index(0, 1, index);
+        EXPECT_EQ(viewModel.sessionItemFromIndex(x_index), vector->getItem(VectorItem::P_X));
+    }
+    EXPECT_EQ(viewModel.findViews(vectors[1]->getItem(VectorItem::P_Y)).size(), 2);
+}
+
 //! Removing single top level item.
 
 TEST_F(DefaultViewModelTest, removeSingleTopItem)
@@ -266,6 +299,31 @@ TEST_F(DefaultViewModelTest, removeSingleTopItem)
     EXPECT_EQ(arguments.at(2).value<int>(), 0);
 }
 
+//! Removing range of top level items.
+
+TEST_F(DefaultViewModelTest, removeTopItemsRange)
+{
+    SessionModel model;
+    auto vectors = model.insertItems<VectorItem>(model.rootItem(), {"", 0}, 5);
+    DefaultViewModel viewModel(&model);
+    EXPECT_EQ(viewModel.rowCount(), 5);
+
+    QSignalSpy spyRemove(&viewModel, &DefaultViewModel::rowsRemoved);
+
+    model.removeItems(model.rootItem(), "", 1, 3);
+
+    // single notification about the whole range
+    ASSERT_EQ(spyRemove.count(), 1);
+    QList<QVariant> arguments = spyRemove.takeFirst();
+    EXPECT_EQ(arguments.at(0).value<QModelIndex>(), QModelIndex());
+    EXPECT_EQ(arguments.at(1).value<int>(), 1);
+    EXPECT_EQ(arguments.at(2).value<int>(), 3);
+
+    EXPECT_EQ(viewModel.rowCount(), 2);
+    EXPECT_EQ(viewModel.sessionItemFromIndex(viewModel.index(0, 0)), vectors[0]);
+    EXPECT_EQ(viewModel.sessionItemFromIndex(viewModel.index(1, 0)), vectors[4]);
+}
+
 //! Remove one of two top level items.
 
 TEST_F(DefaultViewModelTest, removeOneOfTopItems)